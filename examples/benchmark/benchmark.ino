@@ -0,0 +1,101 @@
+/**
+ * @file benchmark.ino
+ * @brief On-target timing benchmark for the SBK_HT16K33 LED driver.
+ *
+ * This example measures, on the actual board and bus, the time taken by:
+ * - `begin()` for all devices,
+ * - one `setLed()` call (averaged, also reported in CPU cycles),
+ * - `show()` after a full redraw, after a single LED change and with no change,
+ * at 100 kHz and 400 kHz I2C clocks. Results are printed to Serial.
+ *
+ * For bytes and transactions per frame without hardware, see extras/host/hostBenchmark.cpp.
+ *
+ * This sketch is part of the SBK_HT16K33 library.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ * @version 2.0.0
+ * @date 2025
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+
+const uint8_t NUM_DEV = 2;           ///< Number of HT16K33 devices in use (0x70, 0x71, ...)
+const uint8_t NUM_ROWS = 16;         ///< Rows per device: 8, 12 or 16
+const uint16_t SETLED_LOOPS = 2000; ///< setLed() calls averaged for the CPU measurement
+SBK_HT16K33 ht(NUM_DEV);
+
+// Redraw every LED of every device with a pattern depending on frame
+void drawFull(uint8_t frame)
+{
+  for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+    for (uint8_t col = 0; col < ht.maxColumns(); col++)
+      for (uint8_t row = 0; row < NUM_ROWS; row++)
+        ht.setLed(dev, row, col, ((row + col + frame) & 1) != 0);
+}
+
+void printResult(const char *label, unsigned long us)
+{
+  Serial.print(label);
+  Serial.print(us);
+  Serial.println(" us");
+}
+
+void runAt(uint32_t clockHz)
+{
+  Serial.print(F("--- I2C clock: "));
+  Serial.print(clockHz / 1000);
+  Serial.println(F(" kHz"));
+
+  // begin() starts the bus, which resets its clock on some cores, then sets clockHz
+  unsigned long t0 = micros();
+  ht.begin(clockHz);
+  printResult("begin():              ", micros() - t0);
+
+  // CPU cost of setLed(), alternating states so every call changes the buffer
+  t0 = micros();
+  for (uint16_t i = 0; i < SETLED_LOOPS; i++)
+    ht.setLed(i % NUM_DEV, i % NUM_ROWS, (i / NUM_ROWS) % 8, (i / 256) & 1);
+  unsigned long elapsed = micros() - t0;
+  Serial.print(F("setLed():             "));
+  Serial.print((float)elapsed / SETLED_LOOPS, 3);
+  Serial.print(F(" us = "));
+  Serial.print((float)elapsed * (F_CPU / 1000000UL) / SETLED_LOOPS, 1);
+  Serial.println(F(" cycles"));
+
+  drawFull(0);
+  t0 = micros();
+  ht.show();
+  printResult("show() full redraw:   ", micros() - t0);
+
+  ht.setLed(0, 0, 0, !ht.getLed(0, 0, 0));
+  t0 = micros();
+  ht.show();
+  printResult("show() one LED:       ", micros() - t0);
+
+  t0 = micros();
+  ht.show();
+  printResult("show() no change:     ", micros() - t0);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+
+  for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+    ht.setDriverRows(dev, NUM_ROWS);
+
+  runAt(100000);
+  runAt(400000);
+}
+
+void loop()
+{
+  // Benchmark runs once in setup()
+}
@@ -0,0 +1,83 @@
+/**
+ * @file Arduino.h
+ * @brief Minimal host (Linux) stand-in for the Arduino core, used by the SBK_HT16K33 simulator.
+ *
+ * Only the subset of the Arduino API used by SBK_HT16K33 and its examples is provided.
+ * Output printed to `Serial` goes to stdout.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define SBK_HT16K33_HOST 1 ///< Defined when building against the host simulator
+
+#define HEX 16
+#define DEC 10
+
+#define F(str) (str)
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+inline void yield() {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+/**
+ * @brief Host version of the Arduino `Print` class, writing to a stdio stream.
+ */
+class Print
+{
+public:
+  explicit Print(FILE *stream = stdout) : _stream(stream) {}
+
+  size_t print(const char *str) { return fputs(str, _stream) < 0 ? 0 : strlen(str); }
+  size_t print(char c) { return fputc(c, _stream) < 0 ? 0 : 1; }
+  size_t print(long value, int base = DEC) { return fprintf(_stream, base == HEX ? "%lX" : "%ld", value); }
+  size_t print(unsigned long value, int base = DEC) { return fprintf(_stream, base == HEX ? "%lX" : "%lu", value); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(double value, int digits = 2) { return fprintf(_stream, "%.*f", digits, value); }
+
+  size_t println() { return print('\n'); }
+  template <typename T>
+  size_t println(T value) { return print(value) + println(); }
+  template <typename T>
+  size_t println(T value, int format) { return print(value, format) + println(); }
+
+private:
+  FILE *_stream;
+};
+
+/**
+ * @brief Host version of the Arduino serial port.
+ */
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
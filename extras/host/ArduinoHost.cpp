@@ -0,0 +1,132 @@
+/**
+ * @file ArduinoHost.cpp
+ * @brief Host (Linux) implementation of the Arduino core and Wire stand-ins.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include "Arduino.h"
+#include "Wire.h"
+
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+TwoWire Wire;
+TwoWire Wire1;
+
+static const std::chrono::steady_clock::time_point _hostStart = std::chrono::steady_clock::now();
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _hostStart).count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _hostStart).count();
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+TwoWire::TwoWire()
+    : _clock(100000),
+      _bufferSize(BUFFER_LENGTH),
+      _txAddr(0),
+      _txLen(0),
+      _rxLen(0),
+      _rxPos(0)
+{
+    memset(_devices, 0, sizeof(_devices));
+    resetStats();
+}
+
+void TwoWire::beginTransmission(uint8_t addr)
+{
+    _txAddr = addr & 0x7F;
+    _txLen = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+    if (_txLen >= _bufferSize)
+    {
+        _stats.truncated++;
+        return 0;
+    }
+
+    _txBuf[_txLen++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t len)
+{
+    size_t n = 0;
+    while (n < len && write(data[n]))
+        n++;
+    return n;
+}
+
+uint8_t TwoWire::endTransmission(bool)
+{
+    SimI2CDevice *device = _devices[_txAddr];
+
+    _stats.transactions++;
+
+    if (!device)
+    {
+        _stats.bytesOut++; // Address byte only
+        _stats.nacks++;
+        return 2; // NACK on address
+    }
+
+    _stats.bytesOut += 1 + _txLen;
+
+    if (!device->onWrite(_txBuf, _txLen))
+    {
+        _stats.nacks++;
+        return 3; // NACK on data
+    }
+
+    return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t quantity, bool)
+{
+    SimI2CDevice *device = _devices[addr & 0x7F];
+
+    _rxLen = 0;
+    _rxPos = 0;
+    _stats.transactions++;
+    _stats.bytesOut++; // Address byte
+
+    if (!device)
+    {
+        _stats.nacks++;
+        return 0;
+    }
+
+    _rxLen = (uint8_t)device->onRead(_rxBuf, quantity < _bufferSize ? quantity : _bufferSize);
+    if (!_rxLen)
+        _stats.nacks++;
+
+    _stats.bytesIn += _rxLen;
+    return _rxLen;
+}
+
+double TwoWire::busTimeMicros(uint32_t hz) const
+{
+    unsigned long cycles = 9 * (_stats.bytesOut + _stats.bytesIn) + 2 * _stats.transactions;
+    return cycles * 1e6 / hz;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file SBK_HT16K33_Sim.cpp
+ * @brief Implementation of the virtual HT16K33 device and multiplexer of the host simulator.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include "SBK_HT16K33_Sim.h"
+
+SBK_HT16K33_SimDevice::SBK_HT16K33_SimDevice()
+    : _responding(true)
+{
+    reset();
+    resetStats();
+}
+
+void SBK_HT16K33_SimDevice::reset(uint8_t ramFill)
+{
+    memset(_ram, ramFill, sizeof(_ram));
+    memset(_keys, 0, sizeof(_keys));
+    _pointer = 0;
+    _oscillator = false;
+    _displayOn = false;
+    _blink = 0;
+    _dimming = 0x0F; // Power-on default: 16/16 duty
+    _rowInt = 0;
+    _intFlag = false;
+}
+
+bool SBK_HT16K33_SimDevice::onWrite(const uint8_t *data, size_t len)
+{
+    if (!_responding)
+        return false;
+
+    _transactions++;
+    _bytes += 1 + len;
+
+    if (!len)
+        return true; // Address-only probe
+
+    uint8_t cmd = data[0];
+
+    switch (cmd & 0xF0)
+    {
+    case 0x00: // Display data address pointer, followed by RAM data
+        _pointer = cmd & 0x0F;
+        for (size_t i = 1; i < len; i++)
+        {
+            _ram[_pointer] = data[i];
+            _pointer = (_pointer + 1) & 0x0F; // Auto-increment wraps within display RAM
+            _ramWrites++;
+        }
+        break;
+    case 0x20: // System setup
+        _oscillator = cmd & 0x01;
+        break;
+    case 0x40: // Key data address pointer
+    case 0x60: // INT flag address pointer
+        _pointer = cmd;
+        break;
+    case 0x80: // Display setup
+        _displayOn = cmd & 0x01;
+        _blink = cmd & 0x06;
+        break;
+    case 0xA0: // ROW/INT set
+        _rowInt = cmd & 0x03;
+        break;
+    case 0xE0: // Dimming set
+        _dimming = cmd & 0x0F;
+        break;
+    default:
+        break;
+    }
+
+    return true;
+}
+
+size_t SBK_HT16K33_SimDevice::onRead(uint8_t *data, size_t len)
+{
+    if (!_responding)
+        return 0;
+
+    _transactions++;
+    _bytes += 1;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        if (_pointer < 0x10)
+        {
+            data[i] = _ram[_pointer];
+            _pointer = (_pointer + 1) & 0x0F;
+        }
+        else if (_pointer >= 0x40 && _pointer < 0x46)
+        {
+            data[i] = _keys[_pointer - 0x40];
+            if (++_pointer == 0x46)
+            {
+                _pointer = 0x40;
+                _intFlag = false; // Reading the key RAM clears the INT flag
+            }
+        }
+        else if (_pointer == 0x60)
+        {
+            data[i] = _intFlag ? 0xFF : 0x00;
+        }
+        else
+        {
+            data[i] = 0x00;
+        }
+    }
+
+    return len;
+}
+
+void SBK_HT16K33_SimDevice::setKey(uint8_t keyIdx, bool pressed)
+{
+    if (keyIdx >= 39)
+        return;
+
+    uint8_t ks = keyIdx / 13;
+    uint8_t k = keyIdx % 13;
+    uint8_t byteIdx = ks * 2 + (k >> 3);
+    uint8_t mask = 1 << (k & 0x07);
+    uint8_t prev = _keys[byteIdx];
+
+    if (pressed)
+        _keys[byteIdx] |= mask;
+    else
+        _keys[byteIdx] &= ~mask;
+
+    if (_keys[byteIdx] != prev)
+        _intFlag = true;
+}
+
+void SBK_HT16K33_SimDevice::render(uint8_t rows, FILE *stream) const
+{
+    for (uint8_t r = 0; r < rows && r < 16; r++)
+    {
+        for (uint8_t c = 0; c < 8; c++)
+            fputc(led(r, c) ? '#' : '.', stream);
+        fputc('\n', stream);
+    }
+}
+
+SimTCA9548A::SimTCA9548A()
+    : _wire(nullptr), _control(0), _selects(0)
+{
+    memset(_devices, 0, sizeof(_devices));
+    for (uint8_t a = 0; a < 128; a++)
+    {
+        _ports[a].mux = this;
+        _ports[a].addr = a;
+    }
+}
+
+bool SimTCA9548A::onWrite(const uint8_t *data, size_t len)
+{
+    if (len)
+    {
+        _control = data[len - 1];
+        _selects++;
+    }
+    return true;
+}
+
+size_t SimTCA9548A::onRead(uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        data[i] = _control;
+    return len;
+}
+
+void SimTCA9548A::connect(TwoWire &wire, uint8_t addr)
+{
+    _wire = &wire;
+    _wire->attach(addr, *this);
+
+    for (uint8_t a = 0; a < 128; a++)
+    {
+        for (uint8_t ch = 0; ch < 8; ch++)
+        {
+            if (_devices[ch][a])
+            {
+                _wire->attach(a, _ports[a]);
+                break;
+            }
+        }
+    }
+}
+
+void SimTCA9548A::attach(uint8_t channel, uint8_t addr, SimI2CDevice &device)
+{
+    if (channel > 7)
+        return;
+
+    _devices[channel][addr & 0x7F] = &device;
+    if (_wire)
+        _wire->attach(addr, _ports[addr & 0x7F]);
+}
+
+bool SimTCA9548A::Port::onWrite(const uint8_t *data, size_t len)
+{
+    bool ack = false;
+    for (uint8_t ch = 0; ch < 8; ch++)
+    {
+        SimI2CDevice *device = mux->_devices[ch][addr];
+        if ((mux->_control & (1 << ch)) && device)
+            ack |= device->onWrite(data, len);
+    }
+    return ack;
+}
+
+size_t SimTCA9548A::Port::onRead(uint8_t *data, size_t len)
+{
+    // Several enabled devices at one address would collide: the lowest channel answers
+    for (uint8_t ch = 0; ch < 8; ch++)
+    {
+        SimI2CDevice *device = mux->_devices[ch][addr];
+        if ((mux->_control & (1 << ch)) && device)
+            return device->onRead(data, len);
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file SBK_HT16K33_Sim.h
+ * @brief Virtual HT16K33 device for the SBK_HT16K33 host simulator.
+ *
+ * Decodes the HT16K33 command set (system setup, display setup, dimming, ROW/INT set,
+ * RAM and key data address pointers), keeps the 16-byte display RAM and 6-byte key RAM,
+ * and counts the transactions and bytes it received.
+ *
+ * ```cpp
+ * SBK_HT16K33_SimDevice chip;
+ * Wire.attach(0x70, chip);
+ * ```
+ *
+ * SimTCA9548A models an 8-channel I2C multiplexer, so chips can share addresses on
+ * different channels as in a real multiplexed chain.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#pragma once
+
+#include "Wire.h"
+
+/**
+ * @class SBK_HT16K33_SimDevice
+ * @brief Behavioral model of one HT16K33 chip on the simulated I2C bus.
+ */
+class SBK_HT16K33_SimDevice : public SimI2CDevice
+{
+public:
+  SBK_HT16K33_SimDevice();
+
+  bool onWrite(const uint8_t *data, size_t len) override;
+  size_t onRead(uint8_t *data, size_t len) override;
+
+  /// Power-cycle the chip: oscillator and display off, RAM filled with `ramFill`.
+  void reset(uint8_t ramFill = 0x00);
+
+  /// When false, the chip NACKs every transaction (unplugged or faulty device).
+  void setResponding(bool responding) { _responding = responding; }
+  bool responding() const { return _responding; }
+
+  bool oscillatorOn() const { return _oscillator; }
+  bool displayOn() const { return _displayOn; }
+  uint8_t blink() const { return _blink; }         ///< Blink bits as in HT16K33_BLINK_* (0x00–0x06)
+  uint8_t brightness() const { return _dimming; }  ///< Dimming level (0–15)
+  uint8_t rowInt() const { return _rowInt; }       ///< Last ROW/INT set bits (0–3)
+
+  uint8_t ram(uint8_t addr) const { return _ram[addr & 0x0F]; }
+  /// Display RAM word of a column (C-line), bit n = row n.
+  uint16_t column(uint8_t colIdx) const { return _ram[colIdx * 2] | (_ram[colIdx * 2 + 1] << 8); }
+  /// LED state as seen by the chip.
+  bool led(uint8_t rowIdx, uint8_t colIdx) const { return (column(colIdx) >> rowIdx) & 0x01; }
+
+  /// Press or release a key of the key matrix (0–38, key = KS line × 13 + K line).
+  void setKey(uint8_t keyIdx, bool pressed);
+  bool intFlag() const { return _intFlag; }
+
+  unsigned long transactions() const { return _transactions; } ///< Transactions received (ACKed)
+  unsigned long bytes() const { return _bytes; }               ///< Bytes received, address bytes included
+  unsigned long ramWrites() const { return _ramWrites; }       ///< Display RAM bytes written
+  void resetStats() { _transactions = _bytes = _ramWrites = 0; }
+
+  /// Print the display RAM as an ASCII matrix (rows top to bottom, columns left to right).
+  void render(uint8_t rows = 16, FILE *stream = stdout) const;
+
+private:
+  uint8_t _ram[16];
+  uint8_t _keys[6];
+  uint8_t _pointer; ///< Address pointer: 0x00–0x0F display RAM, 0x40–0x45 key RAM, 0x60 INT flag
+  bool _oscillator;
+  bool _displayOn;
+  uint8_t _blink;
+  uint8_t _dimming;
+  uint8_t _rowInt;
+  bool _intFlag;
+  bool _responding;
+  unsigned long _transactions;
+  unsigned long _bytes;
+  unsigned long _ramWrites;
+};
+
+/**
+ * @class SimTCA9548A
+ * @brief Behavioral model of a TCA9548A 8-channel I2C multiplexer.
+ *
+ * The control register (one bit per channel) is written at the multiplexer address.
+ * Transactions to a downstream address reach the devices of every enabled channel,
+ * and are NACKed when no enabled channel has a device at that address.
+ *
+ * ```cpp
+ * SimTCA9548A mux;
+ * mux.connect(Wire, 0x77);
+ * mux.attach(2, 0x70, chip); // chip at 0x70 on channel 2
+ * ```
+ */
+class SimTCA9548A : public SimI2CDevice
+{
+public:
+  SimTCA9548A();
+
+  bool onWrite(const uint8_t *data, size_t len) override;
+  size_t onRead(uint8_t *data, size_t len) override;
+
+  /// Attach the multiplexer to a bus at its address (0x70–0x77), routing downstream addresses.
+  void connect(TwoWire &wire, uint8_t addr);
+  /// Attach a device at a 7-bit address on a channel (0–7).
+  void attach(uint8_t channel, uint8_t addr, SimI2CDevice &device);
+
+  uint8_t control() const { return _control; }       ///< Enabled channels, bit n = channel n
+  unsigned long selects() const { return _selects; } ///< Control register writes
+  void resetStats() { _selects = 0; }
+
+private:
+  /// Bus-side stand-in for one downstream address.
+  class Port : public SimI2CDevice
+  {
+  public:
+    bool onWrite(const uint8_t *data, size_t len) override;
+    size_t onRead(uint8_t *data, size_t len) override;
+
+    SimTCA9548A *mux = nullptr;
+    uint8_t addr = 0;
+  };
+
+  TwoWire *_wire;
+  SimI2CDevice *_devices[8][128];
+  Port _ports[128];
+  uint8_t _control;
+  unsigned long _selects;
+};
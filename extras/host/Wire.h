@@ -0,0 +1,120 @@
+/**
+ * @file Wire.h
+ * @brief Host (Linux) stand-in for the Arduino Wire library, backed by simulated I2C devices.
+ *
+ * `TwoWire` routes transactions to devices attached with `attach()` and keeps bus statistics
+ * (transactions, bytes, NACKs) plus the bus time they would take at the configured clock.
+ * Like the AVR core, bytes written past the transmit buffer size are dropped.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+#ifndef BUFFER_LENGTH
+#define BUFFER_LENGTH 32 ///< Default transmit/receive buffer size (AVR core value)
+#endif
+
+/**
+ * @class SimI2CDevice
+ * @brief Interface of a simulated I2C target.
+ */
+class SimI2CDevice
+{
+public:
+  /**
+   * @brief Handle a write transaction.
+   *
+   * @param data Bytes received after the address byte.
+   * @param len  Number of bytes.
+   * @return true to ACK the transaction, false to NACK it.
+   */
+  virtual bool onWrite(const uint8_t *data, size_t len) = 0;
+
+  /**
+   * @brief Handle a read transaction.
+   *
+   * @param data Destination for the bytes sent back to the controller.
+   * @param len  Number of bytes requested.
+   * @return Number of bytes provided, 0 to NACK the address.
+   */
+  virtual size_t onRead(uint8_t *data, size_t len) = 0;
+};
+
+/**
+ * @brief I2C bus statistics collected by the simulated TwoWire.
+ */
+struct SimI2CStats
+{
+  unsigned long transactions; ///< Write and read transactions, including NACKed ones
+  unsigned long bytesOut;     ///< Bytes sent by the controller, address bytes included
+  unsigned long bytesIn;      ///< Bytes returned by targets
+  unsigned long nacks;        ///< Transactions not acknowledged
+  unsigned long truncated;    ///< Bytes dropped because the transmit buffer was full
+};
+
+/**
+ * @class TwoWire
+ * @brief Simulated I2C controller.
+ */
+class TwoWire
+{
+public:
+  TwoWire();
+
+  void begin() {}
+  void setClock(uint32_t hz) { _clock = hz; }
+  uint32_t getClock() const { return _clock; }
+
+  void beginTransmission(uint8_t addr);
+  void beginTransmission(int addr) { beginTransmission((uint8_t)addr); }
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t len);
+  uint8_t endTransmission(bool sendStop = true);
+
+  uint8_t requestFrom(uint8_t addr, uint8_t quantity, bool sendStop = true);
+  uint8_t requestFrom(int addr, int quantity) { return requestFrom((uint8_t)addr, (uint8_t)quantity); }
+  int available() const { return _rxLen - _rxPos; }
+  int read() { return _rxPos < _rxLen ? _rxBuf[_rxPos++] : -1; }
+
+  /// Attach a simulated device at a 7-bit address (replaces any previous one).
+  void attach(uint8_t addr, SimI2CDevice &device) { _devices[addr & 0x7F] = &device; }
+  /// Remove the device at a 7-bit address: further transactions are NACKed.
+  void detach(uint8_t addr) { _devices[addr & 0x7F] = nullptr; }
+
+  /// Transmit buffer size; bytes written beyond it are dropped (default BUFFER_LENGTH).
+  void setBufferSize(size_t size) { _bufferSize = size < sizeof(_txBuf) ? size : sizeof(_txBuf); }
+  size_t bufferSize() const { return _bufferSize; }
+
+  const SimI2CStats &stats() const { return _stats; }
+  void resetStats() { memset(&_stats, 0, sizeof(_stats)); }
+
+  /**
+   * @brief Bus time of the recorded traffic at a given clock, in microseconds.
+   *
+   * Each byte takes 9 clock cycles (8 data bits + ACK), each transaction about
+   * 2 more for START and STOP conditions.
+   */
+  double busTimeMicros(uint32_t hz) const;
+  double busTimeMicros() const { return busTimeMicros(_clock); }
+
+private:
+  SimI2CDevice *_devices[128];
+  SimI2CStats _stats;
+  uint32_t _clock;
+  size_t _bufferSize;
+  uint8_t _txAddr;
+  uint8_t _txBuf[256];
+  size_t _txLen;
+  uint8_t _rxBuf[256];
+  uint8_t _rxLen;
+  uint8_t _rxPos;
+};
+
+extern TwoWire Wire;
+extern TwoWire Wire1;
@@ -0,0 +1,139 @@
+/**
+ * @file hostAutoConfig.cpp
+ * @brief Checks `beginAuto()` discovery, on the main bus and behind a multiplexer.
+ *
+ * Chips are attached at scattered addresses and channels: `beginAuto()` must find them in
+ * address order, configure them, and shrink or grow the device count back to the constructor's
+ * capacity as chips disappear and come back, for `SBK_HT16K33` and `SBK_HT16K33_Background`.
+ * Exits with 1 if a check fails. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33_Background.h>
+#include "SBK_HT16K33_Sim.h"
+
+static bool check(const char *what, bool ok)
+{
+  printf("%-52s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+static bool checkMainBus()
+{
+  TwoWire wire;
+  SBK_HT16K33_SimDevice chips[3];
+  static const uint8_t ADDR[] = {0x75, 0x70, 0x73};
+  for (uint8_t i = 0; i < 3; i++)
+    wire.attach(ADDR[i], chips[i]);
+
+  SBK_HT16K33 ht(8);
+  ht.setBus(wire);
+  bool ok = true;
+
+  uint8_t n = ht.beginAuto();
+  ok &= check("main bus: 3 chips found in address order", n == 3 && ht.devsNum() == 3 && ht.getAddress(0) == 0x70 &&
+                                                             ht.getAddress(1) == 0x73 && ht.getAddress(2) == 0x75);
+
+  ht.setLed(1, 2, 3, true);
+  ht.show();
+  ok &= check("main bus: found chips configured and drawn", chips[2].oscillatorOn() && chips[2].displayOn() &&
+                                                              chips[2].led(2, 3) && !chips[0].led(2, 3));
+
+  // Regrowth: the lost chip back plus 5 new ones, up to the capacity of 8
+  chips[1].setResponding(false);
+  n = ht.beginAuto();
+  ok &= check("main bus: shrinks when a chip is gone", n == 2 && ht.getAddress(0) == 0x73);
+
+  SBK_HT16K33_SimDevice more[5];
+  static const uint8_t MORE_ADDR[] = {0x71, 0x72, 0x74, 0x76, 0x77};
+  chips[1].setResponding(true);
+  for (uint8_t i = 0; i < 5; i++)
+    wire.attach(MORE_ADDR[i], more[i]);
+  n = ht.beginAuto();
+  ok &= check("main bus: grows back to the capacity", n == 8 && ht.getAddress(7) == 0x77);
+
+  ht.setLed(7, 0, 0, true);
+  ht.show();
+  ok &= check("main bus: grown slots drawn", more[4].led(0, 0) && more[4].displayOn());
+
+  for (uint8_t i = 0; i < 3; i++)
+    chips[i].setResponding(false);
+  for (uint8_t i = 0; i < 5; i++)
+    more[i].setResponding(false);
+  n = ht.beginAuto();
+  ht.setLed(0, 0, 0, true);
+  ht.show();
+  ok &= check("main bus: empty bus gives no device", n == 0);
+
+  return ok;
+}
+
+static bool checkMux()
+{
+  TwoWire wire;
+  SimTCA9548A mux;
+  SBK_HT16K33_SimDevice chips[4];
+  mux.connect(wire, 0x74);
+  wire.attach(0x77, chips[0]); // main bus
+  mux.attach(0, 0x70, chips[1]);
+  mux.attach(0, 0x71, chips[2]);
+  mux.attach(5, 0x72, chips[3]);
+
+  SBK_HT16K33 ht(4);
+  ht.setBus(wire);
+  ht.setMux(0x74);
+  uint8_t n = ht.beginAuto();
+
+  bool found = n == 4;
+  for (uint8_t d = 0; found && d < n; d++)
+    if (ht.getAddress(d) == 0x77)
+      found = ht.getChannel(d) == HT16K33_MUX_NONE;
+    else
+      found = ht.getChannel(d) == (ht.getAddress(d) == 0x72 ? 5 : 0);
+  bool ok = check("mux: main bus and channel chips found once", found);
+
+  for (uint8_t d = 0; d < n; d++)
+    ht.setLed(d, 1, 1, true);
+  ht.show();
+  bool drawn = true;
+  for (uint8_t i = 0; i < 4; i++)
+    drawn = drawn && chips[i].led(1, 1) && chips[i].displayOn();
+  ok &= check("mux: every found chip drawn", drawn);
+
+  return ok;
+}
+
+static bool checkBackground()
+{
+  TwoWire wire;
+  SBK_HT16K33_SimDevice chips[8];
+  for (uint8_t i = 0; i < 8; i++)
+    wire.attach(0x70 + i, chips[i]);
+
+  SBK_HT16K33_Background bg(8);
+  bg.setBus(wire);
+  chips[5].setResponding(false);
+  uint8_t first = bg.beginAuto();
+  chips[5].setResponding(true);
+  uint8_t second = bg.beginAuto();
+
+  bg.setLed(7, 1, 1, true);
+  bg.show();
+  bg.refresh();
+  return check("background: grows back and refreshes", first == 7 && second == 8 && chips[7].led(1, 1));
+}
+
+int main()
+{
+  bool ok = checkMainBus();
+  ok &= checkMux();
+  ok &= checkBackground();
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file hostBackground.cpp
+ * @brief SBK_HT16K33_Background on the host simulator, with a std::thread as refresh task.
+ *
+ * The main thread draws and publishes frames as fast as it can while a consumer thread
+ * plays the FreeRTOS task role. At the end, the chips must hold the last published frame.
+ * See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33_Background.h>
+#include "SBK_HT16K33_Sim.h"
+
+#include <atomic>
+#include <thread>
+
+const uint8_t NUM_DEV = 4;
+const unsigned long NUM_FRAMES = 20000;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SBK_HT16K33_Background ht(NUM_DEV);
+
+// Moving diagonal plus a frame counter in the last column of device 0
+static void drawFrame(unsigned long frame)
+{
+    ht.clear();
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+        for (uint8_t col = 0; col < 7; col++)
+            ht.setLed(dev, (col + frame + dev) % 8, col, true);
+    ht.setColumn(0, 7, frame & 0xFF);
+}
+
+int main()
+{
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+        Wire.attach(0x70 + dev, chips[dev]);
+
+    if (!ht.begin())
+        return 1;
+
+    std::atomic<bool> run(true);
+    std::thread task([&run]() {
+        while (run)
+        {
+            if (!ht.refresh())
+                std::this_thread::yield();
+        }
+        ht.refresh(); // last frame published before stop
+    });
+
+    for (unsigned long frame = 0; frame < NUM_FRAMES; frame++)
+    {
+        drawFrame(frame);
+        ht.show();
+    }
+
+    run = false;
+    task.join();
+
+    unsigned long mismatches = 0;
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+        for (uint8_t col = 0; col < ht.maxColumns(); col++)
+            if (chips[dev].column(col) != ht.getColumn(dev, col))
+                mismatches++;
+
+    printf("published %lu, dropped %lu, written %lu, bus transactions %lu\n",
+           ht.framesPublished(), ht.framesDropped(), ht.framesWritten(), Wire.stats().transactions);
+    printf("last frame on chips: %s\n", mismatches ? "MISMATCH" : "ok");
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file hostBenchmark.cpp
+ * @brief CPU and I2C cost benchmark of SBK_HT16K33 on the host simulator.
+ *
+ * For 1 to 8 devices (28-SOP, 16 rows each) and several realistic workloads, reports:
+ * - CPU time (and TSC cycles on x86) per `setLed()` call,
+ * - I2C transactions and bytes per `show()`,
+ * - simulated bus time per frame at 100 kHz, 400 kHz and 1 MHz,
+ * - CPU time of a row-major sprite copy with `blitRows()` versus a `setLed()` loop.
+ *
+ * See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#endif
+
+static const uint8_t MAX_DEVS = 8;
+static const uint8_t ROWS = 16;
+static const uint8_t COLS = 8;
+static const unsigned FRAMES = 200;
+
+// 5×7 glyphs, one byte per column (bit n = row n), for the scrolling text workload
+static const uint8_t TEXT[] = {
+    0x26, 0x49, 0x49, 0x49, 0x32, 0x00, // S
+    0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, // B
+    0x7F, 0x08, 0x14, 0x22, 0x41, 0x00, // K
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // space
+};
+
+/**
+ * @brief Workload interface: draws frame `f` through setLed() calls.
+ */
+struct Workload
+{
+  const char *name;
+  unsigned (*draw)(SBK_HT16K33 &ht, unsigned f); ///< Returns the number of setLed() calls
+};
+
+// Every LED toggles each frame
+static unsigned drawFull(SBK_HT16K33 &ht, unsigned f)
+{
+  unsigned calls = 0;
+  for (uint8_t d = 0; d < ht.devsNum(); d++)
+    for (uint8_t c = 0; c < COLS; c++)
+      for (uint8_t r = 0; r < ROWS; r++, calls++)
+        ht.setLed(d, r, c, ((r + c + f) & 1) != 0);
+  return calls;
+}
+
+// One LED moves per frame
+static unsigned drawPixel(SBK_HT16K33 &ht, unsigned f)
+{
+  uint8_t n = ht.devsNum();
+  unsigned prev = (f + n * ROWS * COLS - 1) % (n * ROWS * COLS);
+  unsigned cur = f % (n * ROWS * COLS);
+  ht.setLed(prev / (ROWS * COLS), prev % ROWS, (prev / ROWS) % COLS, false);
+  ht.setLed(cur / (ROWS * COLS), cur % ROWS, (cur / ROWS) % COLS, true);
+  return 2;
+}
+
+// Each column is a bar meter whose level sweeps up and down
+static unsigned drawBars(SBK_HT16K33 &ht, unsigned f)
+{
+  unsigned calls = 0;
+  for (uint8_t d = 0; d < ht.devsNum(); d++)
+    for (uint8_t c = 0; c < COLS; c++)
+    {
+      unsigned phase = (f + c * 3 + d * 5) % (2 * ROWS);
+      uint8_t level = phase < ROWS ? phase : 2 * ROWS - phase;
+      for (uint8_t r = 0; r < ROWS; r++, calls++)
+        ht.setLed(d, r, c, r < level);
+    }
+  return calls;
+}
+
+// Text scrolling one column per frame across the chained devices
+static unsigned drawText(SBK_HT16K33 &ht, unsigned f)
+{
+  unsigned calls = 0;
+  for (uint8_t d = 0; d < ht.devsNum(); d++)
+    for (uint8_t c = 0; c < COLS; c++)
+    {
+      uint8_t glyph = TEXT[(d * COLS + c + f) % sizeof(TEXT)];
+      for (uint8_t r = 0; r < ROWS; r++, calls++)
+        ht.setLed(d, r, c, r < 8 && ((glyph >> r) & 0x01));
+    }
+  return calls;
+}
+
+static const Workload WORKLOADS[] = {
+    {"full redraw", drawFull},
+    {"single pixel", drawPixel},
+    {"bar sweep", drawBars},
+    {"scrolling text", drawText},
+};
+
+static SBK_HT16K33_SimDevice chips[MAX_DEVS];
+
+static void runWorkload(const Workload &w, uint8_t devs)
+{
+  SBK_HT16K33 ht(devs);
+  for (uint8_t d = 0; d < devs; d++)
+    ht.setDriverRows(d, ROWS);
+  ht.begin();
+
+  // CPU pass: time the drawing alone, in one block so timer overhead is negligible
+  unsigned long calls = 0;
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+#ifdef BENCH_HAS_TSC
+  unsigned long long c0 = __rdtsc();
+#endif
+  for (unsigned f = 1; f <= FRAMES; f++)
+    calls += w.draw(ht, f);
+#ifdef BENCH_HAS_TSC
+  unsigned long long drawCycles = __rdtsc() - c0;
+#endif
+  double drawNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+
+  // Bus pass: same frames, each followed by show(); the warm-up frame is not counted
+  w.draw(ht, 0);
+  ht.show();
+  Wire.resetStats();
+
+  for (unsigned f = 1; f <= FRAMES; f++)
+  {
+    w.draw(ht, f);
+    ht.show();
+  }
+
+  const SimI2CStats &st = Wire.stats();
+  double perCall = calls ? drawNs / calls : 0;
+#ifdef BENCH_HAS_TSC
+  double cyclesPerCall = calls ? (double)drawCycles / calls : 0;
+#else
+  double cyclesPerCall = 0;
+#endif
+
+  printf("%-15s %4u %9.1f %9.1f %7.2f %8.1f %9.1f %9.1f %9.1f\n",
+         w.name, devs, perCall, cyclesPerCall,
+         (double)st.transactions / FRAMES, (double)(st.bytesOut + st.bytesIn) / FRAMES,
+         Wire.busTimeMicros(100000) / FRAMES, Wire.busTimeMicros(400000) / FRAMES, Wire.busTimeMicros(1000000) / FRAMES);
+}
+
+// Row-major 8×16 sprite copy: blitRows() transpose vs one setLed() per pixel
+static void runBlit()
+{
+  SBK_HT16K33 ht(1);
+  ht.setDriverRows(0, ROWS);
+  ht.begin();
+
+  uint8_t sprite[ROWS];
+  const unsigned loops = 100000;
+  volatile uint8_t sink = 0;
+
+  std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < loops; i++)
+  {
+    for (uint8_t r = 0; r < ROWS; r++)
+      sprite[r] = (uint8_t)(i + r * 37);
+    for (uint8_t r = 0; r < ROWS; r++)
+      for (uint8_t c = 0; c < COLS; c++)
+        ht.setLed(0, r, c, (sprite[r] >> c) & 0x01);
+    sink += ht.getColumn(0, i & 7);
+  }
+  double loopNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / loops;
+
+  t0 = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < loops; i++)
+  {
+    for (uint8_t r = 0; r < ROWS; r++)
+      sprite[r] = (uint8_t)(i + r * 37);
+    ht.blitRows(0, sprite, ROWS);
+    sink += ht.getColumn(0, i & 7);
+  }
+  double blitNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / loops;
+
+  printf("\n8x16 sprite copy: setLed() loop %.1f ns, blitRows() %.1f ns (x%.1f)\n", loopNs, blitNs, loopNs / blitNs);
+  (void)sink;
+}
+
+static void runBegin(uint8_t devs)
+{
+  SBK_HT16K33 ht(devs);
+  Wire.resetStats();
+  ht.begin();
+
+  const SimI2CStats &st = Wire.stats();
+  printf("%-15s %4u %9s %9s %7lu %8lu %9.1f %9.1f %9.1f\n",
+         "begin()", devs, "-", "-", st.transactions, st.bytesOut + st.bytesIn,
+         Wire.busTimeMicros(100000), Wire.busTimeMicros(400000), Wire.busTimeMicros(1000000));
+}
+
+int main()
+{
+  for (uint8_t d = 0; d < MAX_DEVS; d++)
+    Wire.attach(0x70 + d, chips[d]);
+
+  printf("%-15s %4s %9s %9s %7s %8s %9s %9s %9s\n",
+         "workload", "devs", "ns/setLed", "cyc/setLed", "tx/frm", "B/frm", "us@100k", "us@400k", "us@1M");
+
+  static const uint8_t DEVS[] = {1, 2, 4, 8};
+
+  for (uint8_t i = 0; i < sizeof(DEVS); i++)
+    runBegin(DEVS[i]);
+
+  for (size_t w = 0; w < sizeof(WORKLOADS) / sizeof(WORKLOADS[0]); w++)
+    for (uint8_t i = 0; i < sizeof(DEVS); i++)
+      runWorkload(WORKLOADS[w], DEVS[i]);
+
+  runBlit();
+
+  return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file hostDemo.cpp
+ * @brief simpleDemo running on the host simulator, with bus cost report.
+ *
+ * See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+const uint8_t NUM_DEV = 2;
+const uint8_t NUM_ROWS[] = {8, 16};
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SBK_HT16K33 ht(NUM_DEV);
+
+static void report(const char *step)
+{
+    const SimI2CStats &st = Wire.stats();
+    printf("%-24s %4lu transactions %5lu bytes  %8.1f us @100kHz %7.1f us @400kHz\n",
+           step, st.transactions, st.bytesOut + st.bytesIn, Wire.busTimeMicros(100000), Wire.busTimeMicros(400000));
+    Wire.resetStats();
+}
+
+int main()
+{
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+    {
+        Wire.attach(0x70 + dev, chips[dev]);
+        ht.setDriverRows(dev, NUM_ROWS[dev]);
+    }
+
+    ht.begin();
+    report("begin()");
+
+    ht.setBrightness(10);
+    report("setBrightness(10)");
+
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+        for (uint8_t i = 0; i < 8; i++)
+            ht.setLed(dev, i, i, true);
+    ht.show();
+    report("diagonal + show()");
+
+    ht.setLed(1, 15, 7, true);
+    ht.show();
+    report("one LED + show()");
+
+    ht.show();
+    report("unchanged show()");
+
+    for (uint8_t dev = 0; dev < NUM_DEV; dev++)
+    {
+        printf("\nDevice %u (0x%02X): osc=%d display=%d dimming=%u\n",
+               dev, 0x70 + dev, chips[dev].oscillatorOn(), chips[dev].displayOn(), chips[dev].brightness());
+        chips[dev].render(NUM_ROWS[dev]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file hostHealth.cpp
+ * @brief Checks the retry, resync, offline and probe path of a failing device.
+ *
+ * A chip stops answering: the driver must retry, mark it for resync, take it offline after the
+ * resync fails, then leave it alone on the bus. Once it answers again (blank, as after a power
+ * cycle), probing must restore its configuration and display RAM, from `poll()` one device at a
+ * time. Exits with 1 if a check fails. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+static const uint8_t NUM_DEV = 3;
+static const uint16_t PROBE_MS = 5;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SBK_HT16K33 ht(NUM_DEV);
+
+static bool check(const char *what, bool ok)
+{
+  printf("%-52s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+static void drawFrame(uint8_t f)
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = 0; c < 8; c++)
+      ht.setColumn(d, c, (uint16_t)(f * 0x11 + c + d * 0x40) & 0xFF);
+}
+
+// The chip holds the driver's buffer and the configuration set before it failed
+static bool restored(uint8_t d)
+{
+  for (uint8_t c = 0; c < 8; c++)
+    if (chips[d].column(c) != ht.getColumn(d, c))
+      return false;
+  return chips[d].oscillatorOn() && chips[d].displayOn() && chips[d].brightness() == 3 &&
+         chips[d].blink() == HT16K33_BLINK_1HZ;
+}
+
+int main()
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    Wire.attach(0x70 + d, chips[d]);
+  ht.setRetries(2, 0);
+  ht.setProbeInterval(PROBE_MS);
+  ht.begin();
+  ht.setBrightness(3);
+  ht.setBlink(HT16K33_BLINK_1HZ);
+
+  bool ok = true;
+
+  // Failure: 1 attempt + 2 retries, then resync
+  chips[1].setResponding(false);
+  ht.resetTxStats();
+  drawFrame(1);
+  ht.show();
+  SBK_HT16K33_TxStats st = ht.getTxStats(1);
+  ok &= check("failed update retried twice", st.txNack == 3 && st.retries == 2);
+  ok &= check("failed device marked for resync", ht.getHealth(1) == HT16K33_HEALTH_RESYNC);
+  ok &= check("other devices still updated", restored(0) && restored(2));
+
+  // Transient glitch: the chip comes back blank, the resync restores it
+  chips[1].reset(0x55);
+  chips[1].setResponding(true);
+  ht.show();
+  ok &= check("resync restores a glitched chip", ht.getHealth(1) == HT16K33_HEALTH_ONLINE && restored(1));
+
+  // Resync failure: offline, then no more traffic to it
+  chips[1].setResponding(false);
+  drawFrame(2);
+  ht.show();
+  drawFrame(3);
+  ht.show();
+  ok &= check("failed resync takes the device offline", ht.getHealth(1) == HT16K33_HEALTH_OFFLINE);
+
+  ht.setProbeInterval(60000); // no probe during this check
+  Wire.resetStats();
+  for (uint8_t f = 4; f < 10; f++)
+  {
+    drawFrame(f);
+    ht.setBrightness(1, 3);
+    ht.show();
+  }
+  ok &= check("offline device skipped by show() and setters", Wire.stats().nacks == 0);
+  ht.setProbeInterval(PROBE_MS);
+
+  // Recovery through poll(): probed when the interval elapses, then fully restored
+  chips[1].reset(0x55);
+  chips[1].setResponding(true);
+  delay(PROBE_MS + 1);
+  ht.showAsync();
+  while (ht.poll())
+    ;
+  ok &= check("poll() probe restores config and RAM", ht.getHealth(1) == HT16K33_HEALTH_ONLINE && restored(1));
+
+  // Two devices offline: poll() probes one per call
+  chips[0].setResponding(false);
+  chips[2].setResponding(false);
+  for (uint8_t f = 10; f < 12; f++)
+  {
+    drawFrame(f);
+    ht.show();
+  }
+  chips[0].reset();
+  chips[0].setResponding(true);
+  chips[2].reset();
+  chips[2].setResponding(true);
+  delay(PROBE_MS + 1);
+  ht.poll();
+  bool one = (ht.getHealth(0) == HT16K33_HEALTH_OFFLINE) != (ht.getHealth(2) == HT16K33_HEALTH_OFFLINE);
+  ok &= check("poll() probes one offline device per call", one);
+
+  // show() sweeps all that are left
+  delay(PROBE_MS + 1);
+  ht.show();
+  ok &= check("show() probe restores the rest", restored(0) && restored(2) &&
+                                                    ht.getHealth(0) == HT16K33_HEALTH_ONLINE &&
+                                                    ht.getHealth(2) == HT16K33_HEALTH_ONLINE);
+
+  return ok ? 0 : 1;
+}
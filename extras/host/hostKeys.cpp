@@ -0,0 +1,112 @@
+/**
+ * @file hostKeys.cpp
+ * @brief Checks key debouncing, the event queue and ROW/INT interrupt servicing.
+ *
+ * Keys are pressed on simulated chips: a change must be reported only once two scans agree,
+ * a bounce shorter than one scan must not produce events, and `serviceKeys()` must stay off
+ * the bus until `notifyKeyInterrupt()` is called, then scan until the state has settled.
+ * Exits with 1 if a check fails. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+static const uint8_t NUM_DEV = 2;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SBK_HT16K33 ht(NUM_DEV);
+
+static bool check(const char *what, bool ok)
+{
+  printf("%-52s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+// Pops one event and compares it with the expected one
+static bool nextEvent(uint8_t devIdx, uint8_t key, bool pressed)
+{
+  SBK_HT16K33_KeyEvent ev;
+  return ht.readKeyEvent(ev) && ev.devIdx == devIdx && ev.key == key && ev.pressed == pressed;
+}
+
+// Scans until the keys have settled, then empties the queue
+static void settle()
+{
+  SBK_HT16K33_KeyEvent ev;
+  ht.scanKeys();
+  ht.scanKeys();
+  while (ht.readKeyEvent(ev))
+    ;
+}
+
+int main()
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    Wire.attach(0x70 + d, chips[d]);
+  ht.begin();
+
+  bool ok = true;
+
+  // Debounce: a press is reported by the second scan reading it
+  chips[1].setKey(17, true);
+  ok &= check("press: first scan queues nothing", ht.scanKeys() == 0 && !ht.isKeyPressed(1, 17));
+  ok &= check("press: second scan queues the press", ht.scanKeys() == 1 && ht.isKeyPressed(1, 17));
+  ok &= check("press: event carries device and key", nextEvent(1, 17, true) && !ht.keyEventsAvailable());
+
+  // Bounce: released for one scan only
+  chips[1].setKey(17, false);
+  ht.scanKeys();
+  chips[1].setKey(17, true);
+  ht.scanKeys();
+  ht.scanKeys();
+  ok &= check("bounce: no event, key still pressed", !ht.keyEventsAvailable() && ht.isKeyPressed(1, 17));
+
+  chips[1].setKey(17, false);
+  chips[0].setKey(38, true);
+  ht.scanKeys();
+  ht.scanKeys();
+  ok &= check("release and press on two devices", nextEvent(0, 38, true) && nextEvent(1, 17, false));
+  chips[0].setKey(38, false);
+  settle();
+
+  // Queue: events past SBK_HT16K33_KEY_QUEUE_SIZE are dropped, the oldest kept
+  for (uint8_t k = 0; k < SBK_HT16K33_KEY_QUEUE_SIZE + 2; k++)
+    chips[0].setKey(k, true);
+  ht.scanKeys();
+  ok &= check("full queue drops the newest events", ht.scanKeys() == SBK_HT16K33_KEY_QUEUE_SIZE &&
+                                                        ht.keyEventsAvailable() == SBK_HT16K33_KEY_QUEUE_SIZE &&
+                                                        nextEvent(0, 0, true));
+  for (uint8_t k = 0; k < SBK_HT16K33_KEY_QUEUE_SIZE + 2; k++)
+    chips[0].setKey(k, false);
+  settle();
+
+  // Interrupt mode: no traffic until notified, then scans until settled
+  ht.setKeyInterrupt(HT16K33_ROWINT_INT_LOW);
+  ok &= check("ROW/INT pin set to interrupt", chips[0].rowInt() == HT16K33_ROWINT_INT_LOW &&
+                                                  chips[1].rowInt() == HT16K33_ROWINT_INT_LOW);
+
+  Wire.resetStats();
+  ht.serviceKeys();
+  ok &= check("serviceKeys() idle: no bus traffic", Wire.stats().transactions == 0);
+
+  chips[0].setKey(5, true);
+  ok &= check("key change raises the chip INT flag", chips[0].intFlag());
+  ht.notifyKeyInterrupt();
+  uint8_t first = ht.serviceKeys();
+  ok &= check("interrupt: scan reads and clears INT", Wire.stats().transactions > 0 && !chips[0].intFlag());
+  uint8_t second = ht.serviceKeys();
+  ok &= check("interrupt: rescans until debounced", first == 0 && second == 1 && nextEvent(0, 5, true));
+
+  Wire.resetStats();
+  ht.serviceKeys();
+  ok &= check("settled: no bus traffic", Wire.stats().transactions == 0);
+
+  return ok ? 0 : 1;
+}
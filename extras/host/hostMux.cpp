@@ -0,0 +1,132 @@
+/**
+ * @file hostMux.cpp
+ * @brief Checks routing through a TCA9548A multiplexer and the number of channel switches.
+ *
+ * 24 chips on channels 0-3 plus one on the main bus: every update must reach its own chip only,
+ * and `show()` / `poll()` must switch channels once per channel with changes. Without
+ * multiplexer, devices past the 8 addresses of the bus must be left out instead of overwriting
+ * other chips. Exits with 1 if a check fails. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+static const uint8_t MUX_ADDR = 0x77;
+static const uint8_t CHANNELS = 4;
+static const uint8_t PER_CHANNEL = 6;
+static const uint8_t NUM_DEV = CHANNELS * PER_CHANNEL + 1; // last one on the main bus
+static const uint8_t MAIN_DEV = NUM_DEV - 1;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SimTCA9548A mux;
+SBK_HT16K33 ht(NUM_DEV);
+
+static bool check(const char *what, bool ok)
+{
+  printf("%-52s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+// Devices are spread over the channels in turn, so channel order differs from index order
+static uint8_t channelOf(uint8_t d) { return d == MAIN_DEV ? HT16K33_MUX_NONE : d % CHANNELS; }
+static uint8_t addressOf(uint8_t d) { return d == MAIN_DEV ? 0x76 : 0x70 + d / CHANNELS; }
+
+// Every chip holds exactly the driver's buffer
+static bool chipsMatch()
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = 0; c < 8; c++)
+      if (chips[d].column(c) != ht.getColumn(d, c))
+        return false;
+  return true;
+}
+
+static bool checkOverflow()
+{
+  // 12 devices on a bus without multiplexer: 8-11 would reuse the addresses of 0-3
+  TwoWire wire;
+  SBK_HT16K33_SimDevice bus[8];
+  for (uint8_t d = 0; d < 8; d++)
+    wire.attach(0x70 + d, bus[d]);
+
+  SBK_HT16K33 over(12);
+  over.setBus(wire);
+  over.begin();
+
+  bool flagged = true;
+  for (uint8_t d = 0; d < 12; d++)
+    flagged = flagged && (over.getHealth(d) == HT16K33_HEALTH_CONFLICT) == (d >= 8);
+
+  for (uint8_t d = 0; d < 12; d++)
+    over.setColumn(d, 0, 0x10 + d);
+  over.show();
+
+  bool kept = true;
+  for (uint8_t d = 0; d < 8; d++)
+    kept = kept && bus[d].column(0) == 0x10 + d;
+
+  return check("no mux: devices 8-11 flagged as conflicts", flagged) &
+         check("no mux: devices 0-3 not overwritten", kept);
+}
+
+int main()
+{
+  mux.connect(Wire, MUX_ADDR);
+  ht.setMux(MUX_ADDR);
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+  {
+    if (d == MAIN_DEV)
+      Wire.attach(addressOf(d), chips[d]);
+    else
+      mux.attach(channelOf(d), addressOf(d), chips[d]);
+    ht.setAddress(d, addressOf(d), channelOf(d));
+  }
+
+  bool ok = true;
+
+  Wire.resetStats();
+  ht.begin();
+  bool allOn = true;
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    allOn = allOn && chips[d].oscillatorOn() && chips[d].displayOn();
+  ok &= check("begin(): every chip configured, no NACK", allOn && Wire.stats().nacks == 0);
+
+  // One LED per device: one switch per channel, the main bus device needs none
+  mux.resetStats();
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    ht.setLed(d, d % 8, d % 8, true);
+  ht.show();
+  ok &= check("show(): one channel switch per channel", mux.selects() <= CHANNELS);
+  ok &= check("show(): each chip holds its own data", chipsMatch());
+
+  // A single channel with changes, plus the main bus device
+  mux.resetStats();
+  ht.setLed(2, 7, 0, true);
+  ht.setLed(6, 7, 0, true);
+  ht.setLed(MAIN_DEV, 7, 0, true);
+  ht.show();
+  ok &= check("show(): main bus device needs no switch", mux.selects() <= 1 && chipsMatch());
+
+  mux.resetStats();
+  ht.show();
+  ok &= check("show() without changes: no switch", mux.selects() == 0);
+
+  mux.resetStats();
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    ht.setLed(d, 0, 7, true);
+  ht.showAsync();
+  while (ht.poll())
+    ;
+  ok &= check("poll(): one channel switch per channel", mux.selects() <= CHANNELS && chipsMatch());
+
+  ok &= checkOverflow();
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file hostTxBuffer.cpp
+ * @brief Checks that display RAM updates are planned to fit the I2C transmit buffer.
+ *
+ * For transmit buffers of 3 to 17 bytes, then 32, 64, 128 and 256 bytes, the simulated bus drops
+ * bytes past the buffer like the AVR core. Full redraws must be split into the expected number of
+ * transactions with no truncated byte, and the chips must hold the driver's buffer. Exits with 1 on
+ * the first failing size. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+static const uint8_t NUM_DEV = 4;
+static const uint8_t COLS = 8;
+static const unsigned FRAMES = 20;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+
+// Every column of every device changes each frame, all 16 rows used
+static void drawFull(SBK_HT16K33 &ht, unsigned f)
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = 0; c < COLS; c++)
+      ht.setColumn(d, c, (uint16_t)(f * 0x9E37 + c * 0x0101 + d));
+}
+
+// First and last columns only, leaving a gap the planner may bridge or split
+static void drawEdges(SBK_HT16K33 &ht, unsigned f)
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+  {
+    ht.setColumn(d, 0, (uint16_t)(f * 0x3C5A + d));
+    ht.setColumn(d, COLS - 1, (uint16_t)(f * 0x5A3C + d));
+  }
+}
+
+static unsigned mismatches(const SBK_HT16K33 &ht)
+{
+  unsigned bad = 0;
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = 0; c < COLS; c++)
+      if (chips[d].column(c) != ht.getColumn(d, c))
+        bad++;
+  return bad;
+}
+
+static bool checkSize(uint16_t bufferSize)
+{
+  SBK_HT16K33 ht(NUM_DEV);
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    ht.setDriverRows(d, 16);
+  Wire.setBufferSize(bufferSize);
+  ht.setTxBufferSize(bufferSize > 255 ? 255 : bufferSize);
+  ht.begin();
+
+  // Command byte plus 2 bytes per column: (size - 1) / 2 columns per transaction
+  unsigned perTx = ht.getTxBufferSize() > 2 * COLS ? COLS : (ht.getTxBufferSize() - 1) / 2;
+  unsigned txPerDev = (COLS + perTx - 1) / perTx;
+
+  Wire.resetStats();
+  for (unsigned f = 1; f <= FRAMES; f++)
+  {
+    drawFull(ht, f);
+    ht.show();
+  }
+
+  const SimI2CStats &full = Wire.stats();
+  unsigned long expectTx = (unsigned long)FRAMES * NUM_DEV * txPerDev;
+  unsigned long expectBytes = (unsigned long)FRAMES * NUM_DEV * (2 * txPerDev + 2 * COLS); // address + command per tx
+  bool ok = full.truncated == 0 && full.transactions == expectTx && full.bytesOut == expectBytes && !mismatches(ht);
+
+  printf("%4u bytes  full: tx %5lu (expected %5lu) bytes %6lu (expected %6lu) truncated %lu",
+         bufferSize, full.transactions, expectTx, full.bytesOut, expectBytes, full.truncated);
+
+  Wire.resetStats();
+  for (unsigned f = 1; f <= FRAMES; f++)
+  {
+    drawEdges(ht, f);
+    ht.show();
+  }
+
+  const SimI2CStats &edges = Wire.stats();
+  ok = ok && edges.truncated == 0 && !mismatches(ht);
+  printf("  edges: truncated %lu  %s\n", edges.truncated, ok ? "ok" : "FAIL");
+
+  return ok;
+}
+
+int main()
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    Wire.attach(0x70 + d, chips[d]);
+
+  static const uint16_t SIZES[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 32, 64, 128, 256};
+
+  for (uint8_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    if (!checkSize(SIZES[i]))
+      return 1;
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file hostVerify.cpp
+ * @brief Checks that `verify()` repairs corrupted display RAM within its bus budget.
+ *
+ * Display RAM bytes are overwritten behind the driver's back. For budgets of 40, 20 and 9 bytes,
+ * every `verify()` call must stay within the budget (address, read and write bytes) and the
+ * corrupted columns must be rewritten within one cycle over the devices, leaving columns drawn but
+ * not shown yet alone. Exits with 1 if a check fails. See extras/host/README.md for build instructions.
+ *
+ * Part of the SBK_HT16K33 library host simulator.
+ * https://github.com/sbarabe/SBK_HT16K33
+ *
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SBK_HT16K33.h>
+#include "SBK_HT16K33_Sim.h"
+
+static const uint8_t NUM_DEV = 3;
+static const uint8_t COLS = 8;
+
+SBK_HT16K33_SimDevice chips[NUM_DEV];
+SBK_HT16K33 ht(NUM_DEV);
+
+static bool check(const char *what, bool ok)
+{
+  printf("%-52s %s\n", what, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+// Overwrites one display RAM byte, as a glitch on the chip would
+static void corrupt(uint8_t addr, uint8_t ramAddr, uint8_t value)
+{
+  Wire.beginTransmission(addr);
+  Wire.write(ramAddr);
+  Wire.write(value);
+  Wire.endTransmission();
+}
+
+static bool checkBudget(uint16_t budget)
+{
+  ht.setVerifyBudget(budget);
+  corrupt(0x71, 4, 0xFF);
+  corrupt(0x72, 14, 0x00);
+  uint8_t unshown = 0x80 | budget;
+  ht.setColumn(2, 0, unshown); // drawn, not shown: must not be checked
+  ht.resetTxStats();
+
+  // Enough calls for one cycle over all columns at this budget
+  unsigned calls = NUM_DEV * (COLS / (budget >= 9 ? (budget - 5) / 4 : 1) + 1);
+  unsigned long worst = 0;
+  unsigned repaired = 0;
+  for (unsigned i = 0; i < calls; i++)
+  {
+    Wire.resetStats();
+    repaired += ht.verify();
+    unsigned long bytes = Wire.stats().bytesOut + Wire.stats().bytesIn;
+    worst = bytes > worst ? bytes : worst;
+  }
+
+  bool match = true;
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = (d == 2); c < COLS; c++)
+      match = match && chips[d].column(c) == ht.getColumn(d, c);
+
+  uint32_t bad = 0;
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    bad += ht.getTxStats(d).ramBad;
+
+  bool ok = worst <= budget && repaired == 2 && bad == 2 && match && chips[2].column(0) != unshown;
+  printf("%4u bytes  worst call %3lu bytes, repaired %u (counted %lu)  %s\n",
+         budget, worst, repaired, (unsigned long)bad, ok ? "ok" : "FAIL");
+
+  ht.show(); // flush the unshown column for the next round
+  return ok;
+}
+
+int main()
+{
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    Wire.attach(0x70 + d, chips[d]);
+  ht.begin();
+
+  for (uint8_t d = 0; d < NUM_DEV; d++)
+    for (uint8_t c = 0; c < COLS; c++)
+      ht.setColumn(d, c, (uint16_t)(0x11 * (c + 1) + d));
+  ht.show();
+
+  static const uint16_t BUDGETS[] = {40, 20, 9};
+  bool ok = true;
+  for (uint8_t i = 0; i < sizeof(BUDGETS) / sizeof(BUDGETS[0]); i++)
+    ok &= checkBudget(BUDGETS[i]);
+
+  // Below one column's worth, verify() does nothing rather than overrun
+  ht.setVerifyBudget(8);
+  Wire.resetStats();
+  ht.verify();
+  ok &= check("budget too small for a column: no traffic", Wire.stats().transactions == 0);
+
+  // Offline devices are skipped
+  chips[1].setResponding(false);
+  ht.setColumn(1, 0, 0x01);
+  ht.show();
+  ht.show();
+  ht.setVerifyBudget(40);
+  Wire.resetStats();
+  for (uint8_t i = 0; i < 2 * NUM_DEV; i++)
+    ht.verify();
+  ok &= check("offline device not read back", Wire.stats().nacks == 0);
+
+  return ok ? 0 : 1;
+}
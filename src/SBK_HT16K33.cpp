@@ -20,24 +20,169 @@
 
 #include "SBK_HT16K33.h"
 
+// Bar masks: n lowest bits set, indexed by level (0–16)
+const uint16_t SBK_HT16K33::_barMasks[17] PROGMEM = {
+    0x0000, 0x0001, 0x0003, 0x0007, 0x000F, 0x001F, 0x003F, 0x007F, 0x00FF,
+    0x01FF, 0x03FF, 0x07FF, 0x0FFF, 0x1FFF, 0x3FFF, 0x7FFF, 0xFFFF};
+
 SBK_HT16K33::SBK_HT16K33(uint8_t devsNum)
-    : _devsNum(constrain(devsNum, 1, 8)),
-      _buffer(nullptr)
+    : _devsNum(constrain(devsNum, 1, SBK_HT16K33_MAX_DEVICES)),
+      _devsCapacity(_devsNum),
+      _devs(nullptr),
+      _buffer(nullptr),
+      _front(nullptr),
+      _ownsStorage(true),
+      _asyncDev(0),
+      _verifyDev(0),
+      _verifyCol(0),
+      _verifyBudget(40),
+      _buses(),
+      _busesNum(1),
+      _txBus(0),
+      _txBufferSize(SBK_HT16K33_TX_BUFFER > 255 ? 255 : SBK_HT16K33_TX_BUFFER),
+      _retries(2),
+      _retryDelayUs(100),
+      _probeIntervalMs(1000),
+      _lastProbe(0),
+      _probeDev(0),
+      _muxAddr(0),
+      _orderFirst(0),
+      _keyHead(0),
+      _keyCount(0),
+      _keysPending(false),
+      _keysUnsettled(false)
 {
-    for (uint8_t i = 0; i < _devsNum; i++)
-        _i2c_addr[i] = 0x70 + i; // 0x70 == 112 decimal
+    _buses[0].wire = &Wire;
+    _buses[0].muxChannel = HT16K33_MUX_NONE;
 
-    for (uint8_t i = 0; i < _devsNum; i++)
-        _maxRows[i] = _defaultRowBufferSize; // 8 rows (anodes) default value
+    // Device table sized to the actual device count
+    _devs = (Device *)calloc(_devsNum, sizeof(Device));
+    if (!_devs)
+    {
+        _devsNum = _devsCapacity = 0; // Allocation failed: behave as an empty driver
+        return;
+    }
+
+    _initDevices();
+}
+
+SBK_HT16K33::SBK_HT16K33(uint8_t devsNum, Device *devs, uint16_t *buffer)
+    : _devsNum(devsNum),
+      _devsCapacity(devsNum),
+      _devs(devs),
+      _buffer(buffer),
+      _front(nullptr),
+      _ownsStorage(false),
+      _asyncDev(0),
+      _verifyDev(0),
+      _verifyCol(0),
+      _verifyBudget(40),
+      _buses(),
+      _busesNum(1),
+      _txBus(0),
+      _txBufferSize(SBK_HT16K33_TX_BUFFER > 255 ? 255 : SBK_HT16K33_TX_BUFFER),
+      _retries(2),
+      _retryDelayUs(100),
+      _probeIntervalMs(1000),
+      _lastProbe(0),
+      _probeDev(0),
+      _muxAddr(0),
+      _orderFirst(0),
+      _keyHead(0),
+      _keyCount(0),
+      _keysPending(false),
+      _keysUnsettled(false)
+{
+    _buses[0].wire = &Wire;
+    _buses[0].muxChannel = HT16K33_MUX_NONE;
+
+    _initDevices();
 }
 
 SBK_HT16K33::~SBK_HT16K33()
 {
+    if (_front)
+    {
+        free(_front);
+        _front = nullptr;
+    }
+
+    if (!_ownsStorage)
+        return;
+
     if (_buffer)
     {
         free(_buffer);
         _buffer = nullptr;
     }
+
+    if (_devs)
+    {
+        free(_devs);
+        _devs = nullptr;
+    }
+}
+
+void SBK_HT16K33::_initDevices()
+{
+    for (uint8_t i = 0; i < _devsNum; i++)
+    {
+        _devs[i].addr = 0x70 + (i & 0x07);        // 0x70 == 112 decimal
+        _devs[i].channel = HT16K33_MUX_NONE;
+        _devs[i].busIdx = 0;
+        _devs[i].maxRows = _defaultRowBufferSize; // 8 rows (anodes) default value
+        _resetDevice(i);
+    }
+
+    _linkOrder();
+}
+
+void SBK_HT16K33::_checkAddresses()
+{
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        Device &dev = _devs[d];
+        uint8_t channel = _channelOf(d);
+        dev.health = HT16K33_HEALTH_ONLINE;
+
+        // Same bus and address as an earlier device, on its channel or on the main bus (seen on all channels)
+        bool clash = _muxAddr && dev.addr == _muxAddr;
+        for (uint8_t o = 0; o < d && !clash; o++)
+        {
+            uint8_t other = _channelOf(o);
+            clash = _devs[o].busIdx == dev.busIdx && _devs[o].addr == dev.addr &&
+                    (other == channel || other == HT16K33_MUX_NONE || channel == HT16K33_MUX_NONE);
+        }
+
+        if (!clash)
+            continue;
+
+        dev.health = HT16K33_HEALTH_CONFLICT;
+        SBK_HT16K33_LOG(SBK_HT16K33_LOG_ERROR, "[begin] Address conflict, left out dev: ");
+        SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_ERROR, d);
+    }
+}
+
+void SBK_HT16K33::_resetDevice(uint8_t devIdx)
+{
+    Device &dev = _devs[devIdx];
+    dev.dirty = 0;
+    dev.frontDirty = 0;
+    dev.pending = false;
+    dev.brightness = _brightnessUnknown;
+    dev.blink = HT16K33_BLINK_OFF;
+
+    for (uint8_t ks = 0; ks < _keyScanLines; ks++)
+    {
+        dev.keys[ks] = 0;
+        dev.keysRaw[ks] = 0;
+    }
+
+    dev.rowInt = HT16K33_ROWINT_ROW;
+    dev.health = HT16K33_HEALTH_ONLINE;
+#if SBK_HT16K33_TX_STATS
+    dev.stats = SBK_HT16K33_TxStats();
+#endif
 }
 
 uint8_t SBK_HT16K33::setAddress(uint8_t devIdx, uint8_t addr)
@@ -45,38 +190,257 @@ uint8_t SBK_HT16K33::setAddress(uint8_t devIdx, uint8_t addr)
     if (devIdx >= _devsNum || addr < 0x70 || addr > 0x77)
         return 0; // invalid
 
-    _i2c_addr[devIdx] = addr;
+    _devs[devIdx].addr = addr;
+    return 1; // success
+}
+
+uint8_t SBK_HT16K33::setAddress(uint8_t devIdx, uint8_t addr, uint8_t channel)
+{
+    if (channel > 7 && channel != HT16K33_MUX_NONE)
+        return 0; // invalid channel
+
+    if (!setAddress(devIdx, addr))
+        return 0;
+
+    _devs[devIdx].channel = channel;
+    _linkOrder();
+    return 1; // success
+}
+
+void SBK_HT16K33::setMux(uint8_t muxAddr)
+{
+    if (muxAddr && (muxAddr < 0x70 || muxAddr > 0x77))
+        return; // invalid
+
+    _muxAddr = muxAddr;
+    for (uint8_t b = 0; b < _busesNum; b++)
+        _buses[b].muxChannel = HT16K33_MUX_NONE;
+
+    _linkOrder();
+}
+
+void SBK_HT16K33::setRetries(uint8_t retries, uint16_t backoffUs)
+{
+    _retries = retries > 4 ? 4 : retries;
+    _retryDelayUs = backoffUs > 1000 ? 1000 : backoffUs;
+}
+
+#if SBK_HT16K33_TX_STATS
+SBK_HT16K33_TxStats SBK_HT16K33::getTxStats(uint8_t devIdx) const
+{
+    if (devIdx < _devsNum)
+        return _devs[devIdx].stats;
+
+    return SBK_HT16K33_TxStats();
+}
+
+void SBK_HT16K33::resetTxStats(uint8_t devIdx)
+{
+    if (devIdx < _devsNum)
+        _devs[devIdx].stats = SBK_HT16K33_TxStats();
+}
+
+void SBK_HT16K33::resetTxStats()
+{
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        resetTxStats(d);
+    }
+}
+#endif
+
+void SBK_HT16K33::setBus(TwoWire &wire)
+{
+    _buses[0].wire = &wire;
+    _buses[0].bus = nullptr;
+}
+
+void SBK_HT16K33::setBus(SBK_HT16K33_Bus &bus)
+{
+    _buses[0].wire = nullptr;
+    _buses[0].bus = &bus;
+}
+
+uint8_t SBK_HT16K33::setBus(uint8_t devIdx, TwoWire &wire)
+{
+    return _bindBus(devIdx, &wire, nullptr);
+}
+
+uint8_t SBK_HT16K33::setBus(uint8_t devIdx, SBK_HT16K33_Bus &bus)
+{
+    return _bindBus(devIdx, nullptr, &bus);
+}
+
+uint8_t SBK_HT16K33::_bindBus(uint8_t devIdx, TwoWire *wire, SBK_HT16K33_Bus *bus)
+{
+    if (devIdx >= _devsNum)
+        return 0; // invalid
+
+    // Reuse the slot already holding this bus
+    uint8_t b = 0;
+    while (b < _busesNum && (_buses[b].bus != bus || (!bus && _buses[b].wire != wire)))
+        b++;
+
+    if (b == _busesNum)
+    {
+        if (_busesNum >= SBK_HT16K33_MAX_BUSES)
+            return 0; // no slot left
+
+        _buses[b].wire = wire;
+        _buses[b].bus = bus;
+        _buses[b].muxChannel = HT16K33_MUX_NONE;
+        _busesNum++;
+    }
+
+    _devs[devIdx].busIdx = b;
     return 1; // success
 }
 
-void SBK_HT16K33::begin()
+void SBK_HT16K33::begin(uint32_t clockHz)
+{
+    _beginBuses(clockHz);
+    _beginDevices();
+}
+
+uint8_t SBK_HT16K33::beginAuto(uint32_t clockHz)
 {
-    // assign + zero some buffer data
-    _buffer = (uint16_t *)calloc(maxColumns() * _devsNum, sizeof(uint16_t));
+    _beginBuses(clockHz);
+
+    uint8_t found = 0;
+    uint8_t mainBus = 0; // main bus responders (bit n = 0x70 + n), they answer on every channel too
+    _txBus = 0;
+
+    // Main bus first, all multiplexer channels disabled; then channels 0–7 one at a time
+    for (int8_t channel = -1; channel < (_muxAddr ? 8 : 0); channel++)
+    {
+        if (_muxAddr)
+        {
+            _txBegin(_muxAddr);
+            _txWrite(channel < 0 ? 0x00 : 1 << channel);
+            if (_txEnd() != 0)
+            {
+                SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_ERROR, "[beginAuto] Multiplexer not answering");
+                break;
+            }
+        }
+
+        for (uint8_t addr = 0x70; addr <= 0x77; addr++)
+        {
+            if (addr == _muxAddr || (mainBus & (1 << (addr & 0x07))) || !_probe(addr))
+                continue;
+
+            if (channel < 0)
+                mainBus |= 1 << (addr & 0x07);
+
+            SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, "[beginAuto] Found addr: 0x");
+            SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, addr, HEX);
+            SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, " channel: ");
+            SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_INFO, channel);
+
+            if (found >= _devsCapacity)
+                continue; // table full: reported, not used
+
+            // Slot now holding another chip: drop the keys, caches and counters of the previous one
+            Device &dev = _devs[found];
+            uint8_t devChannel = channel < 0 ? HT16K33_MUX_NONE : channel;
+            if (found >= _devsNum || dev.addr != addr || dev.channel != devChannel)
+                _resetDevice(found);
+
+            dev.addr = addr;
+            dev.channel = devChannel;
+            dev.busIdx = 0;
+            found++;
+        }
+    }
+
+    // The probe left the last channel selected
+    _buses[0].muxChannel = HT16K33_MUX_NONE;
+
+    // Queued key events may name slots that now hold another chip
+    _keyCount = 0;
+
+    _devsNum = found;
+    _asyncDev = 0;
+    _linkOrder();
+    if (found)
+        _beginDevices();
+
+    return found;
+}
+
+void SBK_HT16K33::_beginBuses(uint32_t clockHz)
+{
+    for (uint8_t b = 0; b < _busesNum; b++)
+    {
+        SBK_HT16K33_Transport &t = _buses[b];
+
+        if (t.bus)
+            t.bus->begin();
+        else
+            t.wire->begin();
+
+        // Set the clock before the first transaction
+        if (clockHz)
+        {
+            if (t.bus)
+                t.bus->setClock(clockHz);
+            else
+                t.wire->setClock(clockHz);
+        }
+
+        // Multiplexer state is unknown until the first channel selection
+        t.muxChannel = HT16K33_MUX_NONE;
+    }
+}
+
+void SBK_HT16K33::_beginDevices()
+{
+    // assign + zero some buffer data (statically sized instances provide their own)
+    if (!_buffer)
+        _buffer = (uint16_t *)calloc(maxColumns() * _devsCapacity, sizeof(uint16_t)); // room for a later beginAuto()
     if (!_buffer)
+    {
+        SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_ERROR, "[begin] Buffer allocation failed");
         return; // Allocation failed
+    }
 
-    Wire.begin();
+    // Leave out devices that would write over another one's chip
+    _checkAddresses();
 
-    for (uint8_t i = 0; i < _devsNum; i++)
+    // Start oscillators
+    for (uint8_t i = _firstDev(); i < _devsNum; i = _nextDev(i))
     {
-        uint8_t addr = _i2c_addr[i];
-
-        // Start oscillator
-        Wire.beginTransmission(addr);
-        Wire.write(0x21); // turn it on
-        Wire.endTransmission();
+        SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, "[begin] Dev: ");
+        SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, i);
+        SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, " Addr: 0x");
+        SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_INFO, _devs[i].addr, HEX);
 
-        // Enable display, disable blink
-        Wire.beginTransmission(addr);
-        Wire.write(HT16K33_CMD_SETUP | HT16K33_DISPLAY_ON | HT16K33_BLINK_OFF);
-        Wire.endTransmission();
+        _command(i, 0x21); // turn it on
+    }
 
-        // Set default brightness
-        setBrightness(i, 8);
+    // Display RAM content is undefined at power-up: force a full write while the display is still off
+    for (uint8_t i = _firstDev(); i < _devsNum; i = _nextDev(i))
+    {
+        _txDirty(i) = 0xFF;
         clear(i);
         show(i);
     }
+
+    // Set default brightness (the chip state is unknown until then)
+    for (uint8_t i = _firstDev(); i < _devsNum; i = _nextDev(i))
+    {
+        _devs[i].brightness = _brightnessUnknown;
+        setBrightness(i, 8);
+    }
+
+    // Enable displays, disable blink, ROW/INT pin back to row output (cached modes may predate a power cycle)
+    for (uint8_t i = _firstDev(); i < _devsNum; i = _nextDev(i))
+    {
+        _devs[i].blink = HT16K33_BLINK_OFF;
+        _command(i, HT16K33_CMD_SETUP | HT16K33_DISPLAY_ON | HT16K33_BLINK_OFF);
+        _devs[i].rowInt = HT16K33_ROWINT_ROW;
+        _command(i, HT16K33_CMD_ROWINT | HT16K33_ROWINT_ROW);
+    }
 }
 
 void SBK_HT16K33::clear(uint8_t devIdx)
@@ -87,7 +451,14 @@ void SBK_HT16K33::clear(uint8_t devIdx)
     if (_buffer)
     {
         for (uint8_t i = 0; i < maxColumns(); i++)
-            _buffer[_colIndex(devIdx, i)] = 0;
+        {
+            uint16_t index = _colIndex(devIdx, i);
+            if (_buffer[index])
+            {
+                _buffer[index] = 0;
+                _devs[devIdx].dirty |= (1 << i);
+            }
+        }
     }
 }
 
@@ -108,41 +479,93 @@ void SBK_HT16K33::setBrightness(uint8_t devIdx, uint8_t brightness)
     // constrain the brightness to a 4-bit number (0–15)
     brightness &= 0x0F; // limit to 0–15
 
+    // skip the transaction if the device already has this level
+    if (brightness == _devs[devIdx].brightness)
+        return;
+
+    _devs[devIdx].brightness = brightness;
+
     // send the command
-    Wire.beginTransmission(_i2c_addr[devIdx]);
-    Wire.write(HT16K33_CMD_DIMMING | brightness);
-    Wire.endTransmission();
+    _command(devIdx, HT16K33_CMD_DIMMING | brightness);
 }
 
-void SBK_HT16K33::setBrightness(uint8_t brightness)
+uint8_t SBK_HT16K33::getBrightness(uint8_t devIdx) const
 {
+    if (devIdx >= _devsNum)
+        return 0;
 
-    for (uint8_t d = 0; d < _devsNum; d++)
+    // Power-on default of the chip is the maximum duty (16/16)
+    if (_devs[devIdx].brightness == _brightnessUnknown)
+        return 15;
+
+    return _devs[devIdx].brightness;
+}
+
+void SBK_HT16K33::setBrightness(uint8_t brightness)
+{
+    for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
     {
         setBrightness(d, brightness);
     }
 }
 
+void SBK_HT16K33::setBlink(uint8_t devIdx, uint8_t rate)
+{
+    if (devIdx >= _devsNum || (rate & ~0x06))
+        return; // invalid device or rate
+
+    // skip the transaction if the device already blinks at this rate
+    if (rate == _devs[devIdx].blink)
+        return;
+
+    _devs[devIdx].blink = rate;
+
+    _command(devIdx, HT16K33_CMD_SETUP | HT16K33_DISPLAY_ON | rate);
+}
+
+void SBK_HT16K33::setBlink(uint8_t rate)
+{
+    for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
+    {
+        setBlink(d, rate);
+    }
+}
+
+uint8_t SBK_HT16K33::getBlink(uint8_t devIdx) const
+{
+    if (devIdx >= _devsNum)
+        return HT16K33_BLINK_OFF;
+
+    return _devs[devIdx].blink;
+}
+
 void SBK_HT16K33::setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
 {
     if (!_buffer || devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
         return;
 
-    uint8_t index = _colIndex(devIdx, colIdx);
+    uint16_t index = _colIndex(devIdx, colIdx);
+    uint16_t data = _buffer[index];
 
     if (state)
-        _buffer[index] |= (1 << rowIdx);
+        data |= (1 << rowIdx);
     else
-        _buffer[index] &= ~(1 << rowIdx);
+        data &= ~(1 << rowIdx);
+
+    if (data != _buffer[index])
+    {
+        _buffer[index] = data;
+        _devs[devIdx].dirty |= (1 << colIdx);
+    }
 
-    Serial.print("[setLed] Dev: ");
-    Serial.print(devIdx);
-    Serial.print(" Row: ");
-    Serial.print(rowIdx);
-    Serial.print(" Col: ");
-    Serial.print(colIdx);
-    Serial.print(" State: ");
-    Serial.println(state ? "ON" : "OFF");
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, "[setLed] Dev: ");
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, devIdx);
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, " Row: ");
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, rowIdx);
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, " Col: ");
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, colIdx);
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, " State: ");
+    SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_TRACE, state ? "ON" : "OFF");
 }
 
 bool SBK_HT16K33::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
@@ -150,26 +573,233 @@ bool SBK_HT16K33::getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
     if (!_buffer || devIdx >= _devsNum || rowIdx >= maxRows(devIdx) || colIdx >= maxColumns())
         return false; // return a safe default when out of bounds
 
-    uint8_t index = _colIndex(devIdx, colIdx);
+    uint16_t index = _colIndex(devIdx, colIdx);
     return (_buffer[index] >> rowIdx) & 0x01;
 }
 
-void SBK_HT16K33::_write(uint8_t devIdx)
+void SBK_HT16K33::setColumn(uint8_t devIdx, uint8_t colIdx, uint16_t bits, uint16_t mask)
 {
-    if (!_buffer || devIdx >= _devsNum)
+    if (!_buffer || devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    _putColumn(devIdx, colIdx, bits, mask & _rowsMask(devIdx));
+}
+
+uint16_t SBK_HT16K33::getColumn(uint8_t devIdx, uint8_t colIdx) const
+{
+    if (!_buffer || devIdx >= _devsNum || colIdx >= maxColumns())
+        return 0;
+
+    return _buffer[_colIndex(devIdx, colIdx)];
+}
+
+void SBK_HT16K33::setRow(uint8_t devIdx, uint8_t rowIdx, uint8_t bits, uint8_t mask)
+{
+    if (!_buffer || devIdx >= _devsNum || rowIdx >= maxRows(devIdx))
+        return;
+
+    uint16_t rowBit = 1 << rowIdx;
+
+    for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+    {
+        if (mask & (1 << colIdx))
+            _putColumn(devIdx, colIdx, (bits & (1 << colIdx)) ? rowBit : 0, rowBit);
+    }
+}
+
+void SBK_HT16K33::setDeviceRaw(uint8_t devIdx, const uint16_t *cols, uint16_t mask)
+{
+    if (!_buffer || !cols || devIdx >= _devsNum)
         return;
 
-    Wire.beginTransmission(_i2c_addr[devIdx]);
-    Wire.write(HT16K33_CMD_RAM); // Start at address 0x00
+    mask &= _rowsMask(devIdx);
 
     for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+        _putColumn(devIdx, colIdx, cols[colIdx], mask);
+}
+
+void SBK_HT16K33::blitRows(uint8_t devIdx, const uint8_t *rows, uint8_t numRows, uint8_t firstRow)
+{
+    if (!_buffer || !rows || devIdx >= _devsNum)
+        return;
+
+    uint16_t rowsMask = _rowsMask(devIdx);
+
+    for (uint8_t r = 0; r < numRows && firstRow + r < 16; r += 8)
+    {
+        // Gather up to 8 rows, missing ones left blank and masked out
+        uint8_t block[8];
+        uint8_t count = numRows - r < 8 ? numRows - r : 8;
+
+        for (uint8_t i = 0; i < 8; i++)
+            block[i] = i < count ? rows[r + i] : 0;
+
+        uint8_t cols[8];
+        _transpose8(block, cols);
+
+        uint8_t shift = firstRow + r;
+        uint16_t mask = (uint16_t)(pgm_read_word(&_barMasks[count]) << shift) & rowsMask;
+
+        for (uint8_t colIdx = 0; colIdx < maxColumns(); colIdx++)
+            _putColumn(devIdx, colIdx, (uint16_t)cols[colIdx] << shift, mask);
+    }
+}
+
+void SBK_HT16K33::_transpose8(const uint8_t in[8], uint8_t out[8])
+{
+    // Hacker's Delight 8×8 transpose on two 32-bit halves: swap 1×1, 2×2 then 4×4 blocks.
+    // Rows are loaded and columns stored in reverse order to match the bit n = column n layout.
+    uint32_t x = ((uint32_t)in[7] << 24) | ((uint32_t)in[6] << 16) | ((uint32_t)in[5] << 8) | in[4];
+    uint32_t y = ((uint32_t)in[3] << 24) | ((uint32_t)in[2] << 16) | ((uint32_t)in[1] << 8) | in[0];
+    uint32_t t;
+
+    t = (x ^ (x >> 7)) & 0x00AA00AA;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCC;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC;
+    y = y ^ t ^ (t << 14);
+
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    out[7] = x >> 24;
+    out[6] = x >> 16;
+    out[5] = x >> 8;
+    out[4] = x;
+    out[3] = y >> 24;
+    out[2] = y >> 16;
+    out[1] = y >> 8;
+    out[0] = y;
+}
+
+void SBK_HT16K33::setBarLevel(uint8_t devIdx, uint8_t colIdx, uint8_t level, uint8_t peak, uint8_t dir)
+{
+    if (!_buffer || devIdx >= _devsNum || colIdx >= maxColumns())
+        return;
+
+    uint8_t rows = maxRows(devIdx);
+    _putColumn(devIdx, colIdx, _barWord(rows, level, peak, dir), _rowsMask(devIdx));
+}
+
+void SBK_HT16K33::setBarGroupLevel(uint8_t devIdx, uint8_t firstCol, uint8_t numCols, uint8_t level, uint8_t peak, uint8_t dir)
+{
+    if (!_buffer || devIdx >= _devsNum)
+        return;
+
+    uint8_t rows = maxRows(devIdx);
+    uint16_t mask = _rowsMask(devIdx);
+
+    for (uint8_t i = 0; i < numCols && firstCol + i < maxColumns(); i++)
+    {
+        // Level and peak relative to this column's segments
+        uint8_t colLevel = level > rows ? rows : level;
+        uint8_t colPeak = (peak && peak <= rows) ? peak : 0;
+
+        _putColumn(devIdx, firstCol + i, _barWord(rows, colLevel, colPeak, dir), mask);
+
+        level = level > rows ? level - rows : 0;
+        peak = peak > rows ? peak - rows : 0;
+    }
+}
+
+uint16_t SBK_HT16K33::_barWord(uint8_t rows, uint8_t level, uint8_t peak, uint8_t dir)
+{
+    if (level > rows)
+        level = rows;
+    if (peak > rows)
+        peak = 0;
+
+    uint16_t word = pgm_read_word(&_barMasks[level]);
+    if (peak)
+        word |= pgm_read_word(&_barMasks[peak]) ^ pgm_read_word(&_barMasks[peak - 1]);
+
+    if (dir == HT16K33_BAR_REVERSED)
+    {
+        // Mirror within the active rows: segment n lights row (rows - n)
+        uint16_t mirrored = pgm_read_word(&_barMasks[rows]) ^ pgm_read_word(&_barMasks[rows - level]);
+        if (peak)
+            mirrored |= pgm_read_word(&_barMasks[rows - peak + 1]) ^ pgm_read_word(&_barMasks[rows - peak]);
+        word = mirrored;
+    }
+
+    return word;
+}
+
+void SBK_HT16K33::_write(uint8_t devIdx)
+{
+    while (_writeNextRange(devIdx))
+        ;
+}
+
+bool SBK_HT16K33::_writeNextRange(uint8_t devIdx)
+{
+    if (!_buffer || devIdx >= _devsNum)
+        return false;
+
+    if (_devs[devIdx].health >= HT16K33_HEALTH_OFFLINE)
+        return false; // skipped until it answers a probe, or for good on an address conflict
+
+    // A failed transaction left the chip state unknown: restore its configuration and full RAM first
+    if (_devs[devIdx].health == HT16K33_HEALTH_RESYNC && !_restoreConfig(devIdx))
+        return false;
+
+    uint8_t dirty = _txDirty(devIdx);
+    if (!dirty)
+        return false;
+
+    // Double buffering: the chip mirrors the front buffer
+    const uint16_t *src = _front ? _front : _buffer;
+
+    // First dirty column of the range
+    uint8_t first = 0;
+    while (!(dirty & (1 << first)))
+        first++;
+
+    // Extend the range, bridging single clean columns:
+    // resending 2 bytes is cheaper than starting a new transaction.
+    // The range stops where it would overflow the transmit buffer (command byte + 2 bytes per column).
+    uint8_t maxCols = (_txBufferSize - 1) / 2;
+    uint8_t last = first;
+    for (;;)
+    {
+        uint8_t step = (dirty & (1 << (last + 1))) ? 1 : (dirty & (1 << (last + 2))) ? 2 : 0;
+        if (!step || last + step - first >= maxCols)
+            break;
+        last += step;
+    }
+
+    for (uint8_t attempt = 0;; attempt++)
     {
-        uint16_t data = _buffer[_colIndex(devIdx, colIdx)];
-        Wire.write(data & 0xFF);        // LSB
-        Wire.write((data >> 8) & 0xFF); // MSB
+        _txBeginDev(devIdx);
+        _txWrite(HT16K33_CMD_RAM | (first * 2)); // RAM address auto-increments
+
+        for (uint8_t colIdx = first; colIdx <= last; colIdx++)
+        {
+            uint16_t data = src[_colIndex(devIdx, colIdx)];
+            _txWrite(data & 0xFF);        // LSB
+            _txWrite((data >> 8) & 0xFF); // MSB
+        }
+
+        if (_txEndDev(devIdx))
+            break;
+
+        if (attempt >= _retries)
+        {
+            // Part of the RAM may be stale: resync the whole device on the next update
+            _markFailed(devIdx);
+            return false;
+        }
+
+        _backoff(devIdx, attempt);
     }
 
-    Wire.endTransmission();
+    _txDirty(devIdx) &= ~((2 << last) - 1); // drop columns 0..last
+    return true;
 }
 
 void SBK_HT16K33::show(uint8_t devIdx)
@@ -179,13 +809,722 @@ void SBK_HT16K33::show(uint8_t devIdx)
 
 void SBK_HT16K33::show()
 {
-    for (uint8_t d = 0; d < _devsNum; d++)
+    _probeOffline(true);
+
+    if (_busesNum > 1)
     {
-        show(d);
+        _showInterleaved();
+        return;
+    }
+
+    // Grouped by multiplexer channel: one channel switch per channel with changes
+    for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
+    {
+        show(d);
+    }
+}
+
+void SBK_HT16K33::_showInterleaved()
+{
+    // One cursor per bus, each walking its own devices in channel order
+    uint8_t cursor[SBK_HT16K33_MAX_BUSES];
+    for (uint8_t b = 0; b < _busesNum; b++)
+        cursor[b] = _firstDev();
+
+    bool active = true;
+    while (active)
+    {
+        active = false;
+
+        for (uint8_t b = 0; b < _busesNum; b++)
+        {
+            uint8_t &d = cursor[b];
+            // Clean devices still count when a failed command left them waiting for a resync
+            while (d < _devsNum && (_devs[d].busIdx != b || (!_txDirty(d) && _devs[d].health != HT16K33_HEALTH_RESYNC)))
+                d = _nextDev(d);
+
+            if (d >= _devsNum)
+                continue; // nothing left on this bus
+
+            active = true;
+            if (_busBusy(b))
+                continue; // previous non-blocking transfer still running: feed the other buses
+
+            if (!_writeNextRange(d))
+                d = _nextDev(d); // failed or offline device: leave its columns for a later show()
+        }
+    }
+
+    // Let non-blocking transfers complete, as show() returns with the devices updated
+    for (uint8_t b = 0; b < _busesNum; b++)
+    {
+        while (_busBusy(b))
+            yield();
     }
 }
 
-inline uint8_t SBK_HT16K33::_colIndex(uint8_t devIdx, uint8_t colIdx) const
+bool SBK_HT16K33::setDoubleBuffer(bool enable)
+{
+    if (enable == (_front != nullptr))
+        return true;
+
+    if (!enable)
+    {
+        free(_front);
+        _front = nullptr;
+
+        // The drawing buffer may differ from the devices: resend everything
+        for (uint8_t d = 0; d < _devsNum; d++)
+            _devs[d].dirty = 0xFF;
+        return true;
+    }
+
+    _front = (uint16_t *)calloc(maxColumns() * _devsCapacity, sizeof(uint16_t));
+    if (!_front)
+    {
+        SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_ERROR, "[setDoubleBuffer] Buffer allocation failed");
+        return false;
+    }
+
+    // Start from the current image: unsent changes move to the front buffer
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        if (_buffer)
+        {
+            for (uint8_t c = 0; c < maxColumns(); c++)
+                _front[_colIndex(d, c)] = _buffer[_colIndex(d, c)];
+        }
+
+        _devs[d].frontDirty = _devs[d].dirty;
+        _devs[d].dirty = 0;
+    }
+
+    return true;
+}
+
+void SBK_HT16K33::swap()
+{
+    if (!_front || !_buffer)
+        return;
+
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        uint8_t changed = 0;
+
+        // Promote the device's columns in one critical section, so an update
+        // sent from an interrupt never sees half a frame
+        noInterrupts();
+        for (uint8_t c = 0; c < maxColumns(); c++)
+        {
+            uint16_t index = _colIndex(d, c);
+            if (_front[index] != _buffer[index])
+            {
+                _front[index] = _buffer[index];
+                changed |= (1 << c);
+            }
+        }
+        _devs[d].frontDirty |= changed;
+        interrupts();
+
+        _devs[d].dirty = 0;
+    }
+}
+
+void SBK_HT16K33::present()
+{
+    swap();
+    show();
+}
+
+void SBK_HT16K33::showAsync(uint8_t devIdx)
+{
+    if (devIdx >= _devsNum)
+        return;
+
+    _devs[devIdx].pending = true;
+}
+
+void SBK_HT16K33::showAsync()
+{
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        showAsync(d);
+    }
+}
+
+bool SBK_HT16K33::poll()
+{
+    _probeOffline(false); // one device per call keeps poll() short
+
+    // The cursor stays on a device whose bus is busy; later devices on idle buses are fed meanwhile
+    bool waiting = false;
+    uint8_t d = _asyncDev;
+
+    for (uint8_t n = 0; n < _devsNum; n++, d = _nextDev(d) < _devsNum ? _nextDev(d) : _firstDev())
+    {
+        Device &dev = _devs[d];
+
+        if (dev.pending && _busBusy(dev.busIdx))
+        {
+            waiting = true; // Non-blocking transfer still running: retry on the next call
+            continue;
+        }
+
+        if (dev.pending && _writeNextRange(d))
+        {
+            if (_txDirty(d))
+                return true; // More ranges left on this device
+
+            // Device done: resume with the next one on the following call
+            dev.pending = false;
+            if (!waiting)
+                _asyncDev = _nextDev(d) < _devsNum ? _nextDev(d) : _firstDev();
+            return isBusy();
+        }
+
+        // Nothing (left) to send for this device
+        dev.pending = false;
+        if (!waiting)
+            _asyncDev = _nextDev(d) < _devsNum ? _nextDev(d) : _firstDev();
+    }
+
+    return waiting;
+}
+
+uint8_t SBK_HT16K33::verify()
+{
+    if (!_buffer || !_devsNum)
+        return 0;
+
+    const uint16_t *src = _front ? _front : _buffer;
+    uint16_t budget = _verifyBudget;
+    uint8_t repaired = 0;
+
+    if (_verifyDev >= _devsNum)
+    {
+        _verifyDev = _firstDev();
+        _verifyCol = 0;
+    }
+
+    // At most one pass over the devices per call, even if all of them are skipped
+    for (uint8_t visited = 0; visited <= _devsNum;)
+    {
+        uint8_t d = _verifyDev;
+        Device &dev = _devs[d];
+
+        // Columns affordable: read back (3 + 2k bytes) plus a worst-case rewrite (2 + 2k), plus channel switch
+        uint16_t overhead = (_channelOf(d) != HT16K33_MUX_NONE && _channelOf(d) != _buses[dev.busIdx].muxChannel) ? 7 : 5;
+        uint8_t count = budget > overhead ? (budget - overhead) / 4 : 0;
+        if (count > maxColumns() - _verifyCol)
+            count = maxColumns() - _verifyCol;
+
+        bool skip = dev.health != HT16K33_HEALTH_ONLINE || _busBusy(dev.busIdx);
+        if (!skip && !count)
+            break; // budget spent: resume here on the next call
+
+        uint16_t words[_defaultColBufferSize];
+        if (!skip && _readRam(d, _verifyCol, count, words))
+        {
+            budget -= overhead - 2 + 2 * count; // write ahead of the read, address bytes included
+            SBK_HT16K33_COUNT(dev, ramRead, count);
+
+            uint8_t bad = 0;
+            for (uint8_t i = 0; i < count; i++)
+            {
+                uint8_t col = _verifyCol + i;
+                if (!(_txDirty(d) & (1 << col)) && words[i] != src[_colIndex(d, col)])
+                    bad |= 1 << col;
+            }
+
+            if (bad)
+            {
+                // Rewrite only the corrupted columns, keep the pending changes for show()
+                uint8_t pending = _txDirty(d);
+                _txDirty(d) = bad;
+                while (_writeNextRange(d))
+                    ;
+                _txDirty(d) |= pending;
+
+                uint8_t badCount = 0;
+                for (uint8_t b = bad; b; b &= b - 1)
+                    badCount++;
+                SBK_HT16K33_COUNT(dev, ramBad, badCount);
+                repaired += badCount;
+                budget = budget > 2 + 2 * count ? budget - (2 + 2 * count) : 0;
+
+                SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, "[verify] Corrupted RAM dev: ");
+                SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_INFO, d);
+            }
+        }
+        else if (!skip)
+        {
+            _markFailed(d); // read failed: let show() resync the device
+            count = maxColumns() - _verifyCol;
+        }
+        else
+        {
+            count = maxColumns() - _verifyCol;
+        }
+
+        _verifyCol += count;
+        if (_verifyCol >= maxColumns())
+        {
+            _verifyCol = 0;
+            _verifyDev = _nextDev(d) < _devsNum ? _nextDev(d) : _firstDev();
+            visited++;
+        }
+    }
+
+    return repaired;
+}
+
+bool SBK_HT16K33::isBusy() const
+{
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+        uint8_t txDirty = _front ? _devs[d].frontDirty : _devs[d].dirty;
+        if (_devs[d].pending && txDirty && _devs[d].health < HT16K33_HEALTH_OFFLINE)
+            return true;
+    }
+
+    return false;
+}
+
+uint8_t SBK_HT16K33::scanKeys()
+{
+    uint8_t events = 0;
+    _keysUnsettled = false;
+
+    for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
+    {
+        uint16_t raw[_keyScanLines];
+        if (!_readKeyRam(d, raw))
+            continue; // device did not answer, keep its previous state
+
+        Device &dev = _devs[d];
+
+        for (uint8_t ks = 0; ks < _keyScanLines; ks++)
+        {
+            // Debounce: only bits reading the same on two consecutive scans are considered
+            uint16_t steady = ~(raw[ks] ^ dev.keysRaw[ks]);
+            uint16_t changed = (raw[ks] ^ dev.keys[ks]) & steady;
+            dev.keysRaw[ks] = raw[ks];
+
+            if ((raw[ks] ^ dev.keys[ks]) & ~steady)
+                _keysUnsettled = true; // needs one more scan to confirm
+
+            if (!changed)
+                continue;
+
+            dev.keys[ks] ^= changed;
+
+            for (uint8_t k = 0; k < _keyLines; k++)
+            {
+                if ((changed & (1 << k)) && _pushKeyEvent(d, ks * _keyLines + k, raw[ks] & (1 << k)))
+                    events++;
+            }
+        }
+    }
+
+    return events;
+}
+
+uint8_t SBK_HT16K33::serviceKeys()
+{
+    if (!_keysPending && !_keysUnsettled)
+        return 0; // nothing signaled: no bus traffic
+
+    _keysPending = false;
+    return scanKeys();
+}
+
+void SBK_HT16K33::setKeyInterrupt(uint8_t devIdx, uint8_t mode)
+{
+    if (devIdx >= _devsNum || (mode != HT16K33_ROWINT_ROW && mode != HT16K33_ROWINT_INT_LOW && mode != HT16K33_ROWINT_INT_HIGH))
+        return; // invalid device or mode
+
+    if (mode == _devs[devIdx].rowInt)
+        return;
+
+    _devs[devIdx].rowInt = mode;
+
+    _command(devIdx, HT16K33_CMD_ROWINT | mode);
+}
+
+void SBK_HT16K33::setKeyInterrupt(uint8_t mode)
+{
+    for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
+    {
+        setKeyInterrupt(d, mode);
+    }
+}
+
+bool SBK_HT16K33::readKeyEvent(SBK_HT16K33_KeyEvent &event)
+{
+    if (!_keyCount)
+        return false;
+
+    event = _keyQueue[_keyHead];
+    _keyHead = (_keyHead + 1) % SBK_HT16K33_KEY_QUEUE_SIZE;
+    _keyCount--;
+    return true;
+}
+
+bool SBK_HT16K33::isKeyPressed(uint8_t devIdx, uint8_t keyIdx) const
+{
+    if (devIdx >= _devsNum || keyIdx >= maxKeys())
+        return false;
+
+    return (_devs[devIdx].keys[keyIdx / _keyLines] >> (keyIdx % _keyLines)) & 0x01;
+}
+
+bool SBK_HT16K33::_readRam(uint8_t devIdx, uint8_t first, uint8_t count, uint16_t *words)
+{
+    // Point to the first column, then read its LSB and MSB and the following ones (auto-increment)
+    _txBeginDev(devIdx);
+    _txWrite(HT16K33_CMD_RAM | (first * 2));
+    if (!_txEndDev(devIdx))
+        return false;
+
+    if (_rxRequest(_devs[devIdx].addr, count * 2) < count * 2)
+    {
+        SBK_HT16K33_COUNT(_devs[devIdx], txNack, 1);
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t lsb = _rxRead();
+        uint8_t msb = _rxRead();
+        words[i] = lsb | (msb << 8);
+    }
+
+    return true;
+}
+
+bool SBK_HT16K33::_readKeyRam(uint8_t devIdx, uint16_t keys[3])
+{
+    uint8_t addr = _devs[devIdx].addr;
+
+    if (_devs[devIdx].health >= HT16K33_HEALTH_OFFLINE)
+        return false;
+
+    // Point to the key RAM, then read KS0–KS2 (2 bytes each, LSB first)
+    _txBeginDev(devIdx);
+    _txWrite(HT16K33_CMD_KEYS);
+    if (!_txEndDev(devIdx))
+        return false;
+
+    if (_rxRequest(addr, _keyScanLines * 2) < _keyScanLines * 2)
+    {
+        SBK_HT16K33_COUNT(_devs[devIdx], txNack, 1);
+        return false;
+    }
+
+    for (uint8_t ks = 0; ks < _keyScanLines; ks++)
+    {
+        uint8_t lsb = _rxRead();
+        uint8_t msb = _rxRead();
+        keys[ks] = (lsb | (msb << 8)) & ((1 << _keyLines) - 1);
+    }
+
+    return true;
+}
+
+bool SBK_HT16K33::_pushKeyEvent(uint8_t devIdx, uint8_t keyIdx, bool pressed)
+{
+    if (_keyCount >= SBK_HT16K33_KEY_QUEUE_SIZE)
+        return false; // queue full: drop the event
+
+    SBK_HT16K33_KeyEvent &event = _keyQueue[(_keyHead + _keyCount) % SBK_HT16K33_KEY_QUEUE_SIZE];
+    event.devIdx = devIdx;
+    event.key = keyIdx;
+    event.pressed = pressed;
+    _keyCount++;
+    return true;
+}
+
+inline uint8_t &SBK_HT16K33::_txDirty(uint8_t devIdx)
+{
+    return _front ? _devs[devIdx].frontDirty : _devs[devIdx].dirty;
+}
+
+bool SBK_HT16K33::_command(uint8_t devIdx, uint8_t cmd)
+{
+    if (_devs[devIdx].health >= HT16K33_HEALTH_OFFLINE)
+        return false; // settings stay cached, applied by _restoreConfig() on recovery
+
+    for (uint8_t attempt = 0;; attempt++)
+    {
+        _txBeginDev(devIdx);
+        _txWrite(cmd);
+        if (_txEndDev(devIdx))
+            return true;
+
+        if (attempt >= _retries)
+            break;
+
+        _backoff(devIdx, attempt);
+    }
+
+    // The chip may have missed earlier commands too: resync it on the next update
+    _markFailed(devIdx);
+    return false;
+}
+
+bool SBK_HT16K33::_restoreConfig(uint8_t devIdx)
+{
+    Device &dev = _devs[devIdx];
+
+    // Health stays RESYNC meanwhile, so a failure here takes the device offline
+    bool ok = _command(devIdx, 0x21) &&
+              _command(devIdx, HT16K33_CMD_SETUP | HT16K33_DISPLAY_ON | dev.blink) &&
+              (dev.brightness == _brightnessUnknown || _command(devIdx, HT16K33_CMD_DIMMING | dev.brightness)) &&
+              _command(devIdx, HT16K33_CMD_ROWINT | dev.rowInt);
+
+    if (ok)
+    {
+        dev.health = HT16K33_HEALTH_ONLINE;
+        _txDirty(devIdx) = 0xFF; // RAM content unknown: rewrite all columns
+    }
+
+    return ok;
+}
+
+bool SBK_HT16K33::_probe(uint8_t addr)
+{
+    _txBegin(addr);
+    return _txEnd() == 0;
+}
+
+void SBK_HT16K33::_markFailed(uint8_t devIdx)
+{
+    Device &dev = _devs[devIdx];
+
+    if (dev.health == HT16K33_HEALTH_ONLINE)
+    {
+        dev.health = HT16K33_HEALTH_RESYNC;
+        return;
+    }
+
+    if (dev.health != HT16K33_HEALTH_OFFLINE)
+    {
+        SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, "[health] Offline dev: ");
+        SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_INFO, devIdx);
+    }
+    dev.health = HT16K33_HEALTH_OFFLINE;
+}
+
+void SBK_HT16K33::_probeOffline(bool all)
+{
+    if (!_probeIntervalMs || millis() - _lastProbe < _probeIntervalMs)
+        return;
+    _lastProbe = millis();
+
+    if (all)
+    {
+        for (uint8_t d = _firstDev(); d < _devsNum; d = _nextDev(d))
+            _probeDevice(d);
+        return;
+    }
+
+    // Round robin: the next offline device after the one probed last
+    for (uint8_t n = 0; n < _devsNum; n++)
+    {
+        uint8_t d = (_probeDev + n) % _devsNum;
+        if (_devs[d].health != HT16K33_HEALTH_OFFLINE)
+            continue;
+
+        _probeDev = d + 1 < _devsNum ? d + 1 : 0;
+        _probeDevice(d);
+        return;
+    }
+}
+
+void SBK_HT16K33::_probeDevice(uint8_t devIdx)
+{
+    Device &dev = _devs[devIdx];
+    if (dev.health != HT16K33_HEALTH_OFFLINE)
+        return;
+
+    // Address-only transaction: ACK means the chip is back (with a blank, unconfigured state)
+    _txBeginDev(devIdx);
+    if (!_txEndDev(devIdx))
+        return;
+
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_INFO, "[health] Recovered dev: ");
+    SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_INFO, devIdx);
+
+    dev.health = HT16K33_HEALTH_RESYNC;
+    if (_restoreConfig(devIdx))
+        dev.pending = true; // full RAM image goes out with this show() or the next poll()
+}
+
+bool SBK_HT16K33::_txEndDev(uint8_t devIdx)
+{
+    uint8_t status = _txEnd();
+    Device &dev = _devs[devIdx];
+    (void)dev; // only used by the counters
+
+    switch (status)
+    {
+    case 0:
+        SBK_HT16K33_COUNT(dev, txOk, 1);
+        return true;
+    case 2: // NACK on address
+    case 3: // NACK on data
+        SBK_HT16K33_COUNT(dev, txNack, 1);
+        break;
+    case 5: // timeout
+        SBK_HT16K33_COUNT(dev, txTimeout, 1);
+        break;
+    default: // data too long, bus error
+        SBK_HT16K33_COUNT(dev, txError, 1);
+        break;
+    }
+
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, "[tx] Dev: ");
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, devIdx);
+    SBK_HT16K33_LOG(SBK_HT16K33_LOG_TRACE, " Status: ");
+    SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_TRACE, status);
+
+    // The multiplexer may have missed its selection as well: select it again next time
+    _buses[_txBus].muxChannel = HT16K33_MUX_NONE;
+    return false;
+}
+
+void SBK_HT16K33::_backoff(uint8_t devIdx, uint8_t attempt)
+{
+    SBK_HT16K33_COUNT(_devs[devIdx], retries, 1);
+    (void)devIdx;
+
+    if (_retryDelayUs)
+        delayMicroseconds(_retryDelayUs << attempt); // at most 1000 µs << 3
+}
+
+// Default bus: `Wire` is called by name, so the compiler binds its (virtual) members statically
+// as in a sketch using `Wire` directly. Other TwoWire instances go through a pointer.
+
+inline void SBK_HT16K33::_txBegin(uint8_t addr)
+{
+    SBK_HT16K33_Transport &t = _buses[_txBus];
+    if (t.wire == &Wire)
+        Wire.beginTransmission(addr);
+    else if (t.bus)
+        t.bus->beginTransmission(addr);
+    else
+        t.wire->beginTransmission(addr);
+}
+
+inline void SBK_HT16K33::_txBeginDev(uint8_t devIdx)
+{
+    _txBus = _devs[devIdx].busIdx;
+    _selectChannel(devIdx);
+    _txBegin(_devs[devIdx].addr);
+}
+
+void SBK_HT16K33::_selectChannel(uint8_t devIdx)
+{
+    uint8_t channel = _channelOf(devIdx);
+    uint8_t &selected = _buses[_txBus].muxChannel;
+    if (channel == HT16K33_MUX_NONE || channel == selected)
+        return; // main bus device, or channel already selected
+
+    // TCA9548A control register: one bit per enabled channel
+    _txBegin(_muxAddr);
+    _txWrite(1 << channel);
+    selected = (_txEnd() == 0) ? channel : HT16K33_MUX_NONE;
+}
+
+inline uint8_t SBK_HT16K33::_channelOf(uint8_t devIdx) const
+{
+    return _muxAddr ? _devs[devIdx].channel : HT16K33_MUX_NONE;
+}
+
+void SBK_HT16K33::_linkOrder()
+{
+    // Main bus devices first, then channels 0–7, by index within a channel. Built once when the
+    // addressing changes, so walking the devices in channel order costs one lookup per device.
+    uint8_t *link = &_orderFirst;
+    for (uint8_t rank = 0; rank <= 8; rank++) // 0 = main bus, n = channel n - 1
+    {
+        for (uint8_t d = 0; d < _devsNum; d++)
+        {
+            if ((uint8_t)(_channelOf(d) + 1) != rank)
+                continue;
+
+            *link = d;
+            link = &_devs[d].next;
+        }
+    }
+    *link = _devsNum;
+}
+
+inline void SBK_HT16K33::_txWrite(uint8_t data)
+{
+    SBK_HT16K33_Transport &t = _buses[_txBus];
+    if (t.wire == &Wire)
+        Wire.write(data);
+    else if (t.bus)
+        t.bus->write(data);
+    else
+        t.wire->write(data);
+}
+
+inline uint8_t SBK_HT16K33::_txEnd()
+{
+    SBK_HT16K33_Transport &t = _buses[_txBus];
+    if (t.wire == &Wire)
+        return Wire.endTransmission();
+    if (t.bus)
+        return t.bus->endTransmission();
+    return t.wire->endTransmission();
+}
+
+inline uint8_t SBK_HT16K33::_rxRequest(uint8_t addr, uint8_t quantity)
+{
+    SBK_HT16K33_Transport &t = _buses[_txBus];
+    if (t.wire == &Wire)
+        return Wire.requestFrom(addr, quantity);
+    if (t.bus)
+        return t.bus->requestFrom(addr, quantity);
+    return t.wire->requestFrom(addr, quantity);
+}
+
+inline int SBK_HT16K33::_rxRead()
+{
+    SBK_HT16K33_Transport &t = _buses[_txBus];
+    if (t.wire == &Wire)
+        return Wire.read();
+    if (t.bus)
+        return t.bus->read();
+    return t.wire->read();
+}
+
+inline bool SBK_HT16K33::_busBusy(uint8_t busIdx)
+{
+    // TwoWire transfers are blocking: only custom transports can still be running
+    return _buses[busIdx].bus && _buses[busIdx].bus->busy();
+}
+
+inline void SBK_HT16K33::_putColumn(uint8_t devIdx, uint8_t colIdx, uint16_t bits, uint16_t mask)
+{
+    uint16_t index = _colIndex(devIdx, colIdx);
+    uint16_t data = (_buffer[index] & ~mask) | (bits & mask);
+
+    if (data != _buffer[index])
+    {
+        _buffer[index] = data;
+        _devs[devIdx].dirty |= (1 << colIdx);
+    }
+}
+
+inline uint16_t SBK_HT16K33::_rowsMask(uint8_t devIdx) const
+{
+    return (uint16_t)((1UL << maxRows(devIdx)) - 1);
+}
+
+inline uint16_t SBK_HT16K33::_colIndex(uint8_t devIdx, uint8_t colIdx) const
 {
     return devIdx * _defaultColBufferSize + colIdx;
 }
\ No newline at end of file
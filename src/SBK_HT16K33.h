@@ -48,10 +48,223 @@
 
 #define HT16K33_DISPLAY_OFF 0x00
 #define HT16K33_DISPLAY_ON 0x01
-#define HT16K33_BLINK_OFF 0x00
-#define HT16K33_BLINK_1HZ 0x02
-#define HT16K33_BLINK_2HZ 0x04
-#define HT16K33_BLINK_0HZ5 0x06
+#define HT16K33_BLINK_OFF 0x00  ///< Display setup B1:B0 = 00
+#define HT16K33_BLINK_2HZ 0x02  ///< B1:B0 = 01
+#define HT16K33_BLINK_1HZ 0x04  ///< B1:B0 = 10
+#define HT16K33_BLINK_0HZ5 0x06 ///< B1:B0 = 11
+
+// Bar fill directions (setBarLevel)
+#define HT16K33_BAR_NORMAL 0x00   ///< Bar fills from row 0 toward the last active row
+#define HT16K33_BAR_REVERSED 0x01 ///< Bar fills from the last active row toward row 0
+
+// ROW/INT pin modes (HT16K33_CMD_ROWINT)
+#define HT16K33_ROWINT_ROW 0x00      ///< Pin drives its row line (default)
+#define HT16K33_ROWINT_INT_LOW 0x01  ///< Pin is an active-low key interrupt output
+#define HT16K33_ROWINT_INT_HIGH 0x03 ///< Pin is an active-high key interrupt output
+
+// I2C multiplexer channel of a device (0–7 = TCA9548A channel)
+#define HT16K33_MUX_NONE 0xFF ///< Device on the main bus, not behind the multiplexer
+
+// Device health (see getHealth())
+#define HT16K33_HEALTH_ONLINE 0   ///< Device answers, updates are sent normally
+#define HT16K33_HEALTH_RESYNC 1   ///< A transaction failed: configuration and full RAM are resent on next update
+#define HT16K33_HEALTH_OFFLINE 2  ///< Device does not answer: skipped, re-probed every probe interval
+#define HT16K33_HEALTH_CONFLICT 3 ///< Address already used by another device of the same bus: never sent
+
+// Driver log levels
+#define SBK_HT16K33_LOG_NONE 0
+#define SBK_HT16K33_LOG_ERROR 1
+#define SBK_HT16K33_LOG_INFO 2
+#define SBK_HT16K33_LOG_TRACE 3
+
+/**
+ * @brief Compile-time log level of the driver (default: SBK_HT16K33_LOG_NONE).
+ *
+ * Define it as a build flag (e.g. `-DSBK_HT16K33_LOG_LEVEL=3` in PlatformIO `build_flags`)
+ * so the library source sees the same value as the sketch.
+ * With `SBK_HT16K33_LOG_NONE`, all logging compiles out and the output port is never referenced.
+ * `SBK_HT16K33_LOG_TRACE` reports every `setLed()` call and is meant for debug builds only.
+ */
+#ifndef SBK_HT16K33_LOG_LEVEL
+#define SBK_HT16K33_LOG_LEVEL SBK_HT16K33_LOG_NONE
+#endif
+
+/// Print-compatible object receiving the log output (default: Serial).
+#ifndef SBK_HT16K33_LOG_PORT
+#define SBK_HT16K33_LOG_PORT Serial
+#endif
+
+#if SBK_HT16K33_LOG_LEVEL > SBK_HT16K33_LOG_NONE
+#define SBK_HT16K33_LOG(level, ...)                 \
+  do                                                \
+  {                                                 \
+    if ((level) <= SBK_HT16K33_LOG_LEVEL)           \
+      SBK_HT16K33_LOG_PORT.print(__VA_ARGS__);      \
+  } while (0)
+#define SBK_HT16K33_LOGLN(level, ...)               \
+  do                                                \
+  {                                                 \
+    if ((level) <= SBK_HT16K33_LOG_LEVEL)           \
+      SBK_HT16K33_LOG_PORT.println(__VA_ARGS__);    \
+  } while (0)
+#else
+#define SBK_HT16K33_LOG(level, ...)                 \
+  do                                                \
+  {                                                 \
+  } while (0)
+#define SBK_HT16K33_LOGLN(level, ...)               \
+  do                                                \
+  {                                                 \
+  } while (0)
+#endif
+
+/**
+ * @class SBK_HT16K33_Bus
+ * @brief Abstract I2C transport for buses that are not a `TwoWire` instance.
+ *
+ * Implement it to drive displays through another I2C library, a bus multiplexer or a mock.
+ * Plain `TwoWire` buses (`Wire`, `Wire1`, ...) are passed directly to `SBK_HT16K33::setBus()`
+ * and do not go through this interface.
+ */
+class SBK_HT16K33_Bus
+{
+public:
+  virtual void begin() = 0;                                          ///< Initialize the bus
+  virtual void beginTransmission(uint8_t addr) = 0;                  ///< Start a write transaction
+  virtual size_t write(uint8_t data) = 0;                            ///< Queue one byte
+  virtual uint8_t endTransmission() = 0;                             ///< Send queued bytes, 0 on success
+  virtual uint8_t requestFrom(uint8_t addr, uint8_t quantity) = 0;   ///< Read bytes, returns count received
+  virtual int read() = 0;                                            ///< Next received byte, -1 if none
+  virtual void setClock(uint32_t clockHz) { (void)clockHz; }         ///< Set the bus clock (optional)
+  virtual bool busy() { return false; }                              ///< true while a non-blocking transfer runs (optional)
+};
+
+/**
+ * @class SBK_HT16K33_BusAdapter
+ * @brief SBK_HT16K33_Bus wrapper for any class exposing the `TwoWire` API.
+ *
+ * ```cpp
+ * i2c_t3 &bus = Wire2;
+ * SBK_HT16K33_BusAdapter<i2c_t3> adapter(bus);
+ * ht.setBus(adapter);
+ * ```
+ */
+template <typename T>
+class SBK_HT16K33_BusAdapter : public SBK_HT16K33_Bus
+{
+public:
+  explicit SBK_HT16K33_BusAdapter(T &wire) : _wire(wire) {}
+
+  void begin() override { _wire.begin(); }
+  void beginTransmission(uint8_t addr) override { _wire.beginTransmission(addr); }
+  size_t write(uint8_t data) override { return _wire.write(data); }
+  uint8_t endTransmission() override { return _wire.endTransmission(); }
+  uint8_t requestFrom(uint8_t addr, uint8_t quantity) override { return _wire.requestFrom(addr, quantity); }
+  int read() override { return _wire.read(); }
+  void setClock(uint32_t clockHz) override { _wire.setClock(clockHz); }
+
+private:
+  T &_wire;
+};
+
+/// Maximum number of devices per driver. One TCA9548A takes one of the 0x70-0x77 addresses, leaving 7
+/// per channel (56 devices); the rest is headroom for devices on other buses (see setBus()).
+#ifndef SBK_HT16K33_MAX_DEVICES
+#define SBK_HT16K33_MAX_DEVICES 64
+#endif
+
+/// Maximum number of distinct buses per driver (see SBK_HT16K33::setBus(devIdx, ...)).
+#ifndef SBK_HT16K33_MAX_BUSES
+#define SBK_HT16K33_MAX_BUSES 4
+#endif
+
+/// Transmit buffer size of the I2C library in bytes, detected from the core (see SBK_HT16K33::setTxBufferSize()).
+#ifndef SBK_HT16K33_TX_BUFFER
+#if defined(I2C_BUFFER_LENGTH) // ESP32
+#define SBK_HT16K33_TX_BUFFER I2C_BUFFER_LENGTH
+#elif defined(WIRE_BUFFER_SIZE) // RP2040
+#define SBK_HT16K33_TX_BUFFER WIRE_BUFFER_SIZE
+#elif defined(BUFFER_LENGTH) // AVR and most other cores
+#define SBK_HT16K33_TX_BUFFER BUFFER_LENGTH
+#else
+#define SBK_HT16K33_TX_BUFFER 32
+#endif
+#endif
+
+/// Per-device transaction counters (see SBK_HT16K33::getTxStats()): 1 (default) compiles them in (28 bytes
+/// of RAM per device), 0 leaves them out. Set it as a global build flag, like SBK_HT16K33_LOG_LEVEL.
+#ifndef SBK_HT16K33_TX_STATS
+#define SBK_HT16K33_TX_STATS 1
+#endif
+
+#if SBK_HT16K33_TX_STATS
+#define SBK_HT16K33_COUNT(dev, counter, n) ((dev).stats.counter += (n))
+#else
+#define SBK_HT16K33_COUNT(dev, counter, n) ((void)0)
+#endif
+
+/// Capacity of the key event queue filled by SBK_HT16K33::scanKeys().
+#ifndef SBK_HT16K33_KEY_QUEUE_SIZE
+#define SBK_HT16K33_KEY_QUEUE_SIZE 8
+#endif
+
+/**
+ * @brief Key press or release reported by SBK_HT16K33::readKeyEvent().
+ */
+struct SBK_HT16K33_KeyEvent
+{
+  uint8_t devIdx; ///< Device the key belongs to
+  uint8_t key;    ///< Key index (0–38) = KS line × 13 + K line
+  bool pressed;   ///< true = pressed, false = released
+};
+
+/**
+ * @brief Per-device transaction counters, see SBK_HT16K33::getTxStats().
+ */
+struct SBK_HT16K33_TxStats
+{
+  uint32_t txOk;      ///< Transactions acknowledged
+  uint32_t txNack;    ///< Transactions not acknowledged (address or data NACK, short key read)
+  uint32_t txTimeout; ///< Transactions ended by a bus timeout
+  uint32_t txError;   ///< Other failures (data too long, bus error)
+  uint32_t retries;   ///< Transactions repeated after a failure
+  uint32_t ramRead;   ///< Display RAM columns read back by verify()
+  uint32_t ramBad;    ///< Columns read back different from the data sent, then rewritten
+};
+
+/**
+ * @brief Bus record of SBK_HT16K33 (internal).
+ */
+struct SBK_HT16K33_Transport
+{
+  TwoWire *wire;         ///< TwoWire bus, used when bus is nullptr
+  SBK_HT16K33_Bus *bus;  ///< Custom transport, overrides wire when set
+  uint8_t muxChannel;    ///< Multiplexer channel selected on this bus, HT16K33_MUX_NONE if unknown
+};
+
+/**
+ * @brief Per-device state record of SBK_HT16K33 (internal).
+ */
+struct SBK_HT16K33_Device
+{
+  uint8_t addr;              ///< I2C address (0x70–0x77)
+  uint8_t channel;           ///< Multiplexer channel (0–7), HT16K33_MUX_NONE on the main bus
+  uint8_t busIdx;            ///< Bus slot (0 = driver bus)
+  uint8_t next;              ///< Next device in channel order, devsNum after the last
+  uint8_t maxRows;           ///< Active row lines (8, 12 or 16)
+  uint8_t dirty;             ///< Dirty column mask (bit n = column n)
+  uint8_t frontDirty;        ///< Front buffer columns not sent yet (double buffering)
+  bool pending;              ///< Queued by showAsync(), flushed by poll()
+  uint8_t brightness;        ///< Dimming level set (0–15), 0xFF if unknown
+  uint8_t blink;             ///< Blink rate set (HT16K33_BLINK_*)
+  uint16_t keys[3];          ///< Debounced key state per KS line (bit n = K line n)
+  uint16_t keysRaw[3];       ///< Key state read by the previous scan
+  uint8_t rowInt;            ///< ROW/INT pin mode (HT16K33_ROWINT_*)
+  uint8_t health;            ///< HT16K33_HEALTH_* state
+#if SBK_HT16K33_TX_STATS
+  SBK_HT16K33_TxStats stats; ///< Transaction counters
+#endif
+};
 
 /**
  * @class SBK_HT16K33
@@ -63,19 +276,24 @@ public:
   /**
    * @brief Construct a new SBK_HT16K33 instance.
    *
-   * @param devsNum  Number of HT16K33 devices included this driver instance (up to 8). Default is 1.
+   * @param devsNum  Number of HT16K33 devices included this driver instance (up to 8 per bus, up to 7
+   *                 per channel with a multiplexer, see `setMux()` and `setBus()`). Default is 1.
+   *
+   * Device n defaults to address 0x70 + n % 8 on the driver bus. `begin()` leaves out (never writes)
+   * a device whose bus, channel and address are already used by a lower index, e.g. devices 8–11 of
+   * `SBK_HT16K33 ht(12)` without multiplexer: see `getHealth()`.
    */
   SBK_HT16K33(uint8_t devsNum = 1);
 
   /**
-   * @brief Destructor. Frees allocated buffer memory.
+   * @brief Destructor. Frees allocated device table and buffer memory.
    */
   ~SBK_HT16K33();
 
   /**
    * @brief Set the number of active rows (anode outputs) for a specific HT16K33 device.
    *
-   * @param devIdx    Index of the target device (0–7).
+   * @param devIdx    Index of the target device (0 to devsNum() - 1).
    * @param rowsCount Number of active row lines (must be 8, 12, or 16).Default is 8.
    *
    * HT16K33 comes in multiple package variants that determine the number of available anode outputs:
@@ -89,16 +307,16 @@ public:
    */
   void setDriverRows(uint8_t devIdx, uint8_t rowsCount = 8)
   {
-    if (devIdx >= 8 || (rowsCount != 8 && rowsCount != 12 && rowsCount != 16))
+    if (devIdx >= _devsNum || (rowsCount != 8 && rowsCount != 12 && rowsCount != 16))
       return;
 
-    _maxRows[devIdx] = rowsCount;
+    _devs[devIdx].maxRows = rowsCount;
   }
 
   /**
    * @brief Returns the number of active row lines (anode outputs) for a specific HT16K33 device.
    *
-   * @param devIdx Index of the target device (0–7).
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
    *
    * Each row corresponds to a physical R-line (R0–R15) on the HT16K33 chip, which controls the anode side of the matrix.
    * The number of active rows depends on the chip package:
@@ -111,7 +329,7 @@ public:
    *
    * @return Number of active row lines for the given device.
    */
-  uint8_t maxRows(uint8_t devIdx) const { return _maxRows[devIdx]; }
+  uint8_t maxRows(uint8_t devIdx) const { return _devs[devIdx].maxRows; }
 
   /**
    * @brief Returns the number of active column lines (cathode outputs = C0–C7) configured for this instance.
@@ -126,7 +344,7 @@ public:
   /**
    * @brief Returns the total number of addressable LED segments for the specified device.
    *
-   * @param devIdx Index of the device (0–7).
+   * @param devIdx Index of the device (0 to devsNum() - 1).
    *
    * Computed as:
    * `maxRows(devIdx) × maxColumns()`
@@ -146,26 +364,228 @@ public:
   /**
    * @brief Set the I2C address for a specific HT16K33 device.
    *
-   * By default, device 0 uses address 0x70, device 1 uses 0x71, ..., up to device 7 using 0x77.
+   * By default, device 0 uses address 0x70, device 1 uses 0x71, ..., up to device 7 using 0x77
+   * (device n uses 0x70 + n % 8), all on the main bus.
    * This function allows you to override that default address mapping.
    *
-   * @param devIdx Device Index (0–7).
+   * @param devIdx Device Index (0 to devsNum() - 1).
    * @param addr   I2C address to assign (must be in range 0x70–0x77).
    * @return 1 if the address was successfully set, 0 if devIdx or addr is invalid.
    */
   uint8_t setAddress(uint8_t devIdx, uint8_t addr);
 
   /**
-   * @brief Initialize the HT16K33 device at a given I2C address.
+   * @brief Set the multiplexer channel and I2C address of a specific device.
+   *
+   * @param devIdx  Device Index (0 to devsNum() - 1).
+   * @param addr    I2C address on that channel (0x70–0x77).
+   * @param channel Multiplexer channel (0–7), or HT16K33_MUX_NONE for the main bus.
+   * @return 1 if the address was successfully set, 0 if an argument is invalid.
+   *
+   * Devices on different channels may share an address. Main bus addresses must not be reused
+   * behind the multiplexer, nor match the multiplexer address itself.
+   */
+  uint8_t setAddress(uint8_t devIdx, uint8_t addr, uint8_t channel);
+
+  /**
+   * @brief Returns the multiplexer channel of a device, HT16K33_MUX_NONE if on the main bus.
+   */
+  uint8_t getChannel(uint8_t devIdx) const { return devIdx < _devsNum ? _devs[devIdx].channel : HT16K33_MUX_NONE; }
+
+  /**
+   * @brief Returns the I2C address of a device, 0 if devIdx is invalid.
+   */
+  uint8_t getAddress(uint8_t devIdx) const { return devIdx < _devsNum ? _devs[devIdx].addr : 0; }
+
+  /**
+   * @brief Declare a TCA9548A-compatible I2C multiplexer in front of the devices.
+   *
+   * @param muxAddr Multiplexer address (0x70–0x77), 0 to disable.
+   *
+   * The driver selects the channel of a device before talking to it, and only when it differs
+   * from the channel already selected. `show()` and the all-device setters visit devices channel
+   * by channel, so each channel is selected at most once per call. Must be called before `begin()`.
+   */
+  void setMux(uint8_t muxAddr);
+
+  /**
+   * @brief Select the `TwoWire` bus used to reach the devices (default: `Wire`).
+   *
+   * @param wire Bus instance, e.g. `Wire1`.
+   *
+   * With the default `Wire`, calls are bound at compile time as in a sketch using `Wire` directly;
+   * the only cost is one pointer comparison per call. Other instances are reached through a
+   * `TwoWire *`, i.e. one virtual call per byte on cores where `TwoWire::write()` is virtual
+   * (AVR, ESP32, SAMD). Must be called before `begin()`.
+   */
+  void setBus(TwoWire &wire);
+
+  /**
+   * @brief Select a custom transport used to reach the devices.
+   *
+   * @param bus Transport implementing SBK_HT16K33_Bus. It must outlive the driver.
+   *
+   * Use it for non-`TwoWire` I2C libraries (see SBK_HT16K33_BusAdapter) or mocks.
+   * Must be called before `begin()`.
+   */
+  void setBus(SBK_HT16K33_Bus &bus);
+
+  /**
+   * @brief Bind a specific device to another `TwoWire` bus (fan-out over several buses).
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param wire   Bus instance, e.g. `Wire1`.
+   * @return 1 on success, 0 if devIdx is invalid or SBK_HT16K33_MAX_BUSES buses are already in use.
+   *
+   * Devices not bound explicitly use the driver bus (`setBus(wire)`). `show()` interleaves the
+   * updates of the different buses. Must be called before `begin()`.
+   */
+  uint8_t setBus(uint8_t devIdx, TwoWire &wire);
+
+  /**
+   * @brief Bind a specific device to a custom transport (fan-out over several buses).
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param bus    Transport implementing SBK_HT16K33_Bus. It must outlive the driver.
+   * @return 1 on success, 0 if devIdx is invalid or SBK_HT16K33_MAX_BUSES buses are already in use.
+   *
+   * A transport whose `endTransmission()` starts a non-blocking (interrupt or DMA) transfer reports it
+   * with `busy()`: `show()` then feeds the other buses while it runs, so the flush time approaches
+   * the one of the slowest bus. Such a transport must wait in `beginTransmission()` until idle.
+   */
+  uint8_t setBus(uint8_t devIdx, SBK_HT16K33_Bus &bus);
+
+  /**
+   * @brief Returns the number of distinct buses in use (1 unless devices were bound to other buses).
+   */
+  uint8_t busesNum() const { return _busesNum; }
+
+  /**
+   * @brief Set the transmit buffer size of the I2C library, in bytes.
+   *
+   * @param bytes Largest transaction payload the library sends (3–255). Default: SBK_HT16K33_TX_BUFFER.
+   *
+   * Display RAM updates are planned to fit it: a range of columns is split when its command byte
+   * plus 2 bytes per column would exceed the buffer, instead of being silently truncated.
+   * A full device update takes 17 bytes, so any buffer of 17 bytes or more sends it in one transaction.
+   */
+  void setTxBufferSize(uint8_t bytes) { _txBufferSize = bytes < 3 ? 3 : bytes; }
+
+  /**
+   * @brief Returns the transmit buffer size used to plan transactions.
+   */
+  uint8_t getTxBufferSize() const { return _txBufferSize; }
+
+  /**
+   * @brief Configure how failed transactions are repeated.
+   *
+   * @param retries   Extra attempts after a failure (0–4, default 2).
+   * @param backoffUs Delay before the first retry, doubled for each further one (0–1000 µs, default 100).
+   *
+   * When all attempts fail, the device is marked for a full resync: the next `show()` (or `poll()`)
+   * resends its configuration (oscillator, display setup, dimming, ROW/INT) and all RAM columns.
+   * If the resync fails too, the device goes offline (see `getHealth()`).
+   */
+  void setRetries(uint8_t retries, uint16_t backoffUs = 100);
+
+  /**
+   * @brief Returns the health of a device: HT16K33_HEALTH_ONLINE, _RESYNC, _OFFLINE or _CONFLICT.
+   *
+   * Offline devices are skipped by `show()`, `poll()`, the setters and key scanning, so an unplugged
+   * display does not cost an address NACK (or a bus timeout) on every update. Drawing still goes to
+   * the buffer. Offline devices are probed with an address-only transaction every probe interval:
+   * `show()` probes all of them, `poll()` only the next one in turn, so a call stays short. When one
+   * answers again, its configuration and full RAM image are restored.
+   *
+   * HT16K33_HEALTH_CONFLICT is set by `begin()` on a device sharing its bus, channel and address with
+   * a lower index device (or using the multiplexer address): it is never sent, so it cannot overwrite
+   * the other device's chip. Fix the addressing and call `begin()` again.
+   *
+   * @return HT16K33_HEALTH_OFFLINE if devIdx is invalid.
+   */
+  uint8_t getHealth(uint8_t devIdx) const { return devIdx < _devsNum ? _devs[devIdx].health : HT16K33_HEALTH_OFFLINE; }
+
+  /**
+   * @brief Set how often offline devices are probed.
+   *
+   * @param ms Probe interval in milliseconds (default 1000). With `poll()` only, each interval probes
+   *           one offline device, so n offline devices are each probed every n intervals.
+   *           0 disables probing: offline devices then only come back with `begin()`.
+   */
+  void setProbeInterval(uint16_t ms) { _probeIntervalMs = ms; }
+
+  /**
+   * @brief Returns the transaction counters of a device (all zero if devIdx is invalid).
+   *
+   * Every write transaction counts once in `txOk`, `txNack`, `txTimeout` or `txError`
+   * according to the `endTransmission()` status; each repeat also counts in `retries`.
+   *
+   * @note Built with `SBK_HT16K33_TX_STATS=0`, the counters and these functions are compiled out:
+   *       calling them is a build error.
+   */
+#if SBK_HT16K33_TX_STATS
+  SBK_HT16K33_TxStats getTxStats(uint8_t devIdx) const;
+#else
+  SBK_HT16K33_TxStats getTxStats(uint8_t devIdx) const = delete;
+#endif
+
+  /**
+   * @brief Reset the transaction counters of a specific device.
+   */
+#if SBK_HT16K33_TX_STATS
+  void resetTxStats(uint8_t devIdx);
+#else
+  void resetTxStats(uint8_t devIdx) = delete;
+#endif
+
+  /**
+   * @brief Reset the transaction counters of all devices.
    */
-  void begin();
+#if SBK_HT16K33_TX_STATS
+  void resetTxStats();
+#else
+  void resetTxStats() = delete;
+#endif
+
+  /**
+   * @brief Initialize the bus and all HT16K33 devices.
+   *
+   * @param clockHz I2C clock to set after the bus is started, e.g. 400000. 0 keeps the bus default.
+   *
+   * Devices are configured in phases (oscillator, display RAM, dimming, display on) so every display
+   * is switched on with a cleared RAM. Brightness (8), blink (off) and the ROW/INT pin (row output)
+   * are reset, so key interrupts must be enabled again after `begin()`.
+   * The HT16K33 is specified for I2C clocks up to 400 kHz.
+   */
+  void begin(uint32_t clockHz = 0);
+
+  /**
+   * @brief Initialize the bus, find the devices present and initialize them.
+   *
+   * @param clockHz I2C clock to set after the bus is started (see `begin()`).
+   * @return Number of devices found, which becomes `devsNum()`.
+   *
+   * Addresses 0x70–0x77 of the driver bus are probed once each with an address-only transaction,
+   * then, if a multiplexer is declared (`setMux()`), the same addresses on channels 0–7. The device
+   * table is rebuilt from the responders in that order (main bus first, then by channel and address),
+   * so device n is the n-th display found; `getAddress()` and `getChannel()` tell where it is.
+   * Only responders are configured, so missing panels cost no transactions.
+   *
+   * The device count given to the constructor is the table capacity: responders beyond it are ignored.
+   * All devices are bound to the driver bus. If nothing answers, returns 0 and no device is configured.
+   *
+   * It may be called again, e.g. to pick up a panel plugged in since: the table is rebuilt up to the
+   * capacity, and a slot now holding another chip starts with cleared keys, caches and counters.
+   */
+  uint8_t beginAuto(uint32_t clockHz = 0);
 
   /**
    * @brief Clear the display buffer for the specified device.
    *
-   * @param devIdx Index of the target device (0–7).
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
    *
    * This clears the internal buffer for a single HT16K33 device.
+   * Only columns that held lit LEDs are marked dirty.
    * Call `.show(devIdx)` to apply the cleared state to the hardware.
    */
   void clear(uint8_t devIdx);
@@ -181,14 +601,27 @@ public:
   /**
    * @brief Set the brightness level (0–15) for a specific device.
    *
-   * @param devIdx     Index of the target device (0–7).
+   * @param devIdx     Index of the target device (0 to devsNum() - 1).
    * @param brightness Brightness level (0 = dimmest, 15 = brightest).
    *
    * This function sets the brightness for a single HT16K33 device.
    * It is API-compatible with the MAX72xx interface used in SBK_BarDrive.
+   * No I2C transaction is sent if the device already has this level.
    */
   void setBrightness(uint8_t devIdx, uint8_t brightness);
 
+  /**
+   * @brief Returns the brightness level (0–15) last set for a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   *
+   * The value comes from the driver's cache; the device is not queried.
+   * Before any brightness was set, the chip's power-on level (15) is returned.
+   *
+   * @return Brightness level (0–15), or 0 for an invalid device index.
+   */
+  uint8_t getBrightness(uint8_t devIdx) const;
+
   /**
    * @brief Set the brightness level (0–15) for all devices.
    *
@@ -199,6 +632,34 @@ public:
    */
   void setBrightness(uint8_t brightness);
 
+  /**
+   * @brief Set the hardware blink rate for a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param rate   `HT16K33_BLINK_OFF`, `HT16K33_BLINK_2HZ`, `HT16K33_BLINK_1HZ` or `HT16K33_BLINK_0HZ5`.
+   *
+   * The whole display of the device blinks, driven by the chip itself: no further I2C traffic
+   * or redraw is needed while it blinks. No transaction is sent if the rate is unchanged.
+   *
+   * @note Invalid device indices or rates are ignored.
+   */
+  void setBlink(uint8_t devIdx, uint8_t rate);
+
+  /**
+   * @brief Set the hardware blink rate for all devices.
+   *
+   * @param rate `HT16K33_BLINK_OFF`, `HT16K33_BLINK_2HZ`, `HT16K33_BLINK_1HZ` or `HT16K33_BLINK_0HZ5`.
+   */
+  void setBlink(uint8_t rate);
+
+  /**
+   * @brief Returns the blink rate last set for a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @return One of the `HT16K33_BLINK_*` values, `HT16K33_BLINK_OFF` for an invalid device index.
+   */
+  uint8_t getBlink(uint8_t devIdx) const;
+
   /**
    * @brief Returns the number of active HT16K33 devices managed by this driver instance.
    *
@@ -209,12 +670,13 @@ public:
   /**
    * @brief Set the state of an individual LED for a specific device.
    *
-   * @param devIdx  Index of the target device (0–7).
+   * @param devIdx  Index of the target device (0 to devsNum() - 1).
    * @param rowIdx  Row index (0 to maxRows(devIdx) - 1).
    * @param colIdx  Column index (0 to maxColumns() - 1).
    * @param state   true = LED ON, false = LED OFF.
    *
    * This function updates the internal buffer for a single LED on a specific HT16K33 device.
+   * The column is marked dirty only if its state actually changed.
    * You must call `.show()` to apply the changes to the physical display.
    *
    * @note For HT16K33:
@@ -240,14 +702,105 @@ public:
    */
   bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const; ///< Get LED state at (rowIdx, colIdx)
 
+  /**
+   * @brief Set all LEDs of a column (C-line) for a specific device in one store.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param colIdx Column index (0 to maxColumns() - 1).
+   * @param bits   LED states, bit n = row n (1 = ON).
+   * @param mask   Rows to update, bit n = row n (default: all). Other rows keep their state.
+   *
+   * Rows beyond `maxRows(devIdx)` are ignored. You must call `.show()` to apply the changes.
+   */
+  void setColumn(uint8_t devIdx, uint8_t colIdx, uint16_t bits, uint16_t mask = 0xFFFF);
+
+  /**
+   * @brief Get all LED states of a column (C-line) from the internal display buffer.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param colIdx Column index (0 to maxColumns() - 1).
+   * @return LED states, bit n = row n. 0 if the arguments are invalid.
+   */
+  uint16_t getColumn(uint8_t devIdx, uint8_t colIdx) const;
+
+  /**
+   * @brief Set all LEDs of a row (R-line) for a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param rowIdx Row index (0 to maxRows(devIdx) - 1).
+   * @param bits   LED states, bit n = column n (1 = ON).
+   * @param mask   Columns to update, bit n = column n (default: all). Other columns keep their state.
+   *
+   * You must call `.show()` to apply the changes.
+   */
+  void setRow(uint8_t devIdx, uint8_t rowIdx, uint8_t bits, uint8_t mask = 0xFF);
+
+  /**
+   * @brief Load a complete image of a device's display buffer.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param cols   `maxColumns()` column words, bit n = row n (same layout as `setColumn()`).
+   * @param mask   Rows to update in every column (default: all).
+   *
+   * A full-device redraw is `maxColumns()` word stores instead of one `setLed()` per LED.
+   * Only columns whose content changes are marked dirty.
+   */
+  void setDeviceRaw(uint8_t devIdx, const uint16_t *cols, uint16_t mask = 0xFFFF);
+
+  /**
+   * @brief Copy a row-major bitmap (fonts, sprites) into a device's column-major buffer.
+   *
+   * @param devIdx   Index of the target device (0 to devsNum() - 1).
+   * @param rows     Bitmap rows, one byte per row, bit n = column n (1 = ON).
+   * @param numRows  Number of rows to copy (default 8, up to 16).
+   * @param firstRow Device row receiving `rows[0]` (default 0).
+   *
+   * Each block of 8 rows is transposed with a few 32-bit shift/mask steps instead of one
+   * `setLed()` per pixel, then merged into the column words. Rows outside the bitmap keep their state;
+   * rows beyond `maxRows(devIdx)` are ignored.
+   */
+  void blitRows(uint8_t devIdx, const uint8_t *rows, uint8_t numRows = 8, uint8_t firstRow = 0);
+
+  /**
+   * @brief Render a bar meter level on one column (C-line) of a device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param colIdx Column index (0 to maxColumns() - 1).
+   * @param level  Number of lit segments (0 to maxRows(devIdx), larger values are clamped).
+   * @param peak   Peak-hold marker segment, 1-based (0 = no marker).
+   * @param dir    `HT16K33_BAR_NORMAL` (fill from row 0) or `HT16K33_BAR_REVERSED` (fill from last row).
+   *
+   * The column word comes from a precomputed mask table, so the cost is constant whatever the
+   * level, replacing one `setLed()` call per segment.
+   */
+  void setBarLevel(uint8_t devIdx, uint8_t colIdx, uint8_t level, uint8_t peak = 0, uint8_t dir = HT16K33_BAR_NORMAL);
+
+  /**
+   * @brief Render a bar meter spanning several adjacent columns of a device.
+   *
+   * @param devIdx   Index of the target device (0 to devsNum() - 1).
+   * @param firstCol First column of the bar.
+   * @param numCols  Number of columns; each holds maxRows(devIdx) segments.
+   * @param level    Number of lit segments, filling `firstCol` first.
+   * @param peak     Peak-hold marker segment, 1-based (0 = no marker).
+   * @param dir      Fill direction within each column (`HT16K33_BAR_NORMAL` or `HT16K33_BAR_REVERSED`).
+   *
+   * E.g. a 24-segment bar on a 12-row device uses 2 columns. Columns past `maxColumns()` are ignored.
+   */
+  void setBarGroupLevel(uint8_t devIdx, uint8_t firstCol, uint8_t numCols, uint8_t level, uint8_t peak = 0, uint8_t dir = HT16K33_BAR_NORMAL);
+
   /**
    * @brief Push the internal display buffer to a specific device.
    *
-   * @param devIdx Index of the target device (0–7).
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
    *
    * This sends the buffered LED states to the physical HT16K33 display
    * for the specified device only.
    *
+   * Only the columns changed since the last `show()` are transmitted, using the
+   * HT16K33 RAM address auto-increment to write each contiguous dirty range.
+   * Nothing is sent when no column changed.
+   *
    * @note This function must be called after `setLed()` or `clear()` to reflect changes on the hardware.
    */
   void show(uint8_t devIdx); ///< Push buffer to display for one device
@@ -257,17 +810,375 @@ public:
    *
    * This sends the buffered LED states to all HT16K33 devices managed by this driver.
    * Use this to update the entire display after modifying any LED states.
+   * Devices without changes since the last `show()` are skipped.
    */
   void show();
 
-private:
+  /**
+   * @brief Enable or disable double buffering.
+   *
+   * @param enable true to draw into a back buffer published by `swap()` or `present()`.
+   * @return false if the front buffer could not be allocated, true otherwise.
+   *
+   * With double buffering, drawing functions (`setLed()`, `clear()`, ...) only change the back buffer,
+   * while `show()`, `showAsync()` and `poll()` transmit the front buffer. A frame reaches the devices
+   * only once published, so an update in progress never sends a half-drawn frame.
+   * The front buffer is allocated on the heap, including for SBK_HT16K33_Static.
+   */
+  bool setDoubleBuffer(bool enable);
+
+  /**
+   * @brief Returns whether double buffering is enabled.
+   */
+  bool isDoubleBuffered() const { return _front != nullptr; }
+
+  /**
+   * @brief Publish the back buffer to the front buffer (double buffering).
+   *
+   * Only columns that differ from the front buffer are copied and queued for transmission,
+   * so the next `show()` or `showAsync()` sends the minimal update.
+   * Each device is promoted with interrupts disabled. Does nothing without double buffering.
+   */
+  void swap();
+
+  /**
+   * @brief Publish the back buffer and send it to all devices: `swap()` then `show()`.
+   */
+  void present();
+
+  /**
+   * @brief Queue a non-blocking update of a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   *
+   * Nothing is sent immediately: the device's dirty columns are flushed by subsequent `poll()` calls.
+   * LED changes made before the device is fully flushed are included in the same update.
+   */
+  void showAsync(uint8_t devIdx);
+
+  /**
+   * @brief Queue a non-blocking update of all devices.
+   *
+   * Devices without changes cost nothing when polled.
+   */
+  void showAsync();
+
+  /**
+   * @brief Advance a queued `showAsync()` update by one I2C transaction.
+   *
+   * Call it from `loop()`: each call sends at most one contiguous RAM range to one device,
+   * so the time spent on the bus per call stays short and bounded. While a bus reports `busy()`,
+   * its devices wait and the call writes to the next pending device on an idle bus instead.
+   *
+   * @return true if more transactions are pending, false once every queued device is up to date.
+   */
+  bool poll();
+
+  /**
+   * @brief Returns whether a `showAsync()` update still has data to send.
+   *
+   * @return true while queued devices have unsent changes.
+   */
+  bool isBusy() const;
+
+  /**
+   * @brief Read back display RAM and rewrite the columns that differ from the data sent.
+   *
+   * Call it from `loop()` as a low-priority background check, e.g. against EMI glitches. Each call
+   * reads a few columns, resuming where the previous call stopped and cycling through all devices,
+   * and stays within the bus byte budget set by `setVerifyBudget()`. Columns with changes not sent
+   * yet (dirty) and devices that are offline or waiting for a resync are skipped.
+   * Read-backs and mismatches are counted in `getTxStats()` (`ramRead`, `ramBad`); with
+   * `SBK_HT16K33_TX_STATS=0` they are not counted at all.
+   *
+   * @return Number of corrupted columns found and rewritten by this call.
+   */
+  uint8_t verify();
+
+  /**
+   * @brief Set the bus bytes a `verify()` call may use.
+   *
+   * @param bytes Address and data bytes, read and write, per call (default 40). Checking k columns
+   *              of a device costs up to 5 + 4 × k bytes (read back, plus a rewrite if all differ),
+   *              so 9 bytes check one column and 37 a whole device. Retries are not budgeted.
+   */
+  void setVerifyBudget(uint16_t bytes) { _verifyBudget = bytes; }
+
+  /**
+   * @brief Scan the key matrix of all devices and queue press/release events.
+   *
+   * Reads the 6-byte key RAM (`HT16K33_CMD_KEYS`) of each device in one pass.
+   * A key change is accepted once two consecutive scans agree, then compared with the
+   * debounced state to produce events. Call it periodically (e.g. every 10–20 ms).
+   *
+   * @return Number of events queued by this scan.
+   *
+   * @note Events are dropped when the queue (`SBK_HT16K33_KEY_QUEUE_SIZE`) is full.
+   */
+  uint8_t scanKeys();
+
+  /**
+   * @brief Pop the oldest key event from the queue.
+   *
+   * @param event Receives the event.
+   * @return true if an event was returned, false if the queue is empty.
+   */
+  bool readKeyEvent(SBK_HT16K33_KeyEvent &event);
+
+  /**
+   * @brief Returns the number of key events waiting in the queue.
+   */
+  uint8_t keyEventsAvailable() const { return _keyCount; }
+
+  /**
+   * @brief Returns the debounced state of a key.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param keyIdx Key index (0–38) = KS line × 13 + K line.
+   * @return true if the key is pressed, false otherwise or if the arguments are invalid.
+   */
+  bool isKeyPressed(uint8_t devIdx, uint8_t keyIdx) const;
+
+  /**
+   * @brief Returns the number of keys of the HT16K33 key matrix (3 KS × 13 K lines).
+   */
+  static constexpr uint8_t maxKeys() { return _keyScanLines * _keyLines; }
+
+  /**
+   * @brief Configure the ROW/INT pin of a specific device.
+   *
+   * @param devIdx Index of the target device (0 to devsNum() - 1).
+   * @param mode   `HT16K33_ROWINT_ROW`, `HT16K33_ROWINT_INT_LOW` or `HT16K33_ROWINT_INT_HIGH`.
+   *
+   * In interrupt mode the chip asserts the pin when its key data changes, so key RAM
+   * only needs to be read when `notifyKeyInterrupt()` was called (see `serviceKeys()`).
+   * The pin then no longer drives its row line, which must be left unused.
+   *
+   * @note Invalid device indices or modes are ignored.
+   */
+  void setKeyInterrupt(uint8_t devIdx, uint8_t mode);
+
+  /**
+   * @brief Configure the ROW/INT pin of all devices.
+   *
+   * @param mode `HT16K33_ROWINT_ROW`, `HT16K33_ROWINT_INT_LOW` or `HT16K33_ROWINT_INT_HIGH`.
+   */
+  void setKeyInterrupt(uint8_t mode);
+
+  /**
+   * @brief Flag that a device signaled a key change. Safe to call from an ISR.
+   *
+   * Attach it to the INT line, e.g. with `attachInterrupt()`:
+   * ```cpp
+   * void onKeyInt() { ht.notifyKeyInterrupt(); }
+   * ```
+   * No I2C access is done here; the key RAM is read by the next `serviceKeys()`.
+   */
+  void notifyKeyInterrupt() { _keysPending = true; }
+
+  /**
+   * @brief Scan the keys only if an interrupt was signaled.
+   *
+   * Call it from `loop()`. Without a pending interrupt it returns immediately without any
+   * I2C traffic. After an interrupt it runs `scanKeys()`, and keeps scanning on later calls
+   * until the debounced state has settled.
+   *
+   * @return Number of events queued by this call.
+   */
+  uint8_t serviceKeys();
+
+protected:
+  typedef SBK_HT16K33_Device Device;
+
+  /**
+   * @brief Construct a driver on caller-owned storage (used by SBK_HT16K33_Static).
+   *
+   * @param devsNum Number of devices (1 to SBK_HT16K33_MAX_DEVICES).
+   * @param devs    Device table with at least `devsNum` entries.
+   * @param buffer  Zeroed display buffer of `devsNum × maxColumns()` words.
+   *
+   * The storage is not freed by the destructor.
+   */
+  SBK_HT16K33(uint8_t devsNum, Device *devs, uint16_t *buffer);
+
   uint8_t _devsNum = 1;
-  uint8_t _i2c_addr[8];
-  uint8_t _maxRows[8];
+  uint8_t _devsCapacity;                              ///< Device table entries, devsNum() may be lower after beginAuto()
+  Device *_devs;                                      ///< Device table (devsNum entries)
   uint16_t *_buffer;                                  ///< 8 cols × 16-bit for 16 rows
+  uint16_t *_front;                                   ///< Front buffer when double buffering, else nullptr
+  bool _ownsStorage;                                  ///< true if _devs and _buffer are heap-allocated
+  uint8_t _asyncDev;                                  ///< Device currently flushed by poll()
+  uint8_t _verifyDev;                                 ///< Device verify() resumes with
+  uint8_t _verifyCol;                                 ///< Column verify() resumes with
+  uint16_t _verifyBudget;                             ///< Bus bytes per verify() call
+  SBK_HT16K33_Transport _buses[SBK_HT16K33_MAX_BUSES]; ///< Bus slots, slot 0 = driver bus
+  uint8_t _busesNum;                                  ///< Bus slots in use
+  uint8_t _txBus;                                     ///< Bus slot of the current transaction
+  uint8_t _txBufferSize;                              ///< Largest transaction payload, in bytes
+  uint8_t _retries;                                   ///< Extra attempts after a failed transaction
+  uint16_t _retryDelayUs;                             ///< First retry delay, doubled on each retry
+  uint16_t _probeIntervalMs;                          ///< Offline device probe interval, 0 = never
+  unsigned long _lastProbe;                           ///< millis() of the last offline probe
+  uint8_t _probeDev;                                  ///< Next device probed by poll() (round robin)
+  uint8_t _muxAddr;                                   ///< Multiplexer address, 0 if none
+  uint8_t _orderFirst;                                ///< First device in channel order
   static constexpr uint8_t _defaultRowBufferSize = 8; // HT16K33 comes in 3 versions 20SOP, 24SOP and 28SOP: 8, 12 or 16 rows (anodes)
   static constexpr uint8_t _defaultColBufferSize = 8;
+  static constexpr uint8_t _brightnessUnknown = 0xFF; ///< Device brightness not known yet
+  static constexpr uint8_t _keyScanLines = 3;         ///< KS0–KS2
+  static constexpr uint8_t _keyLines = 13;            ///< K0–K12
+
+  SBK_HT16K33_KeyEvent _keyQueue[SBK_HT16K33_KEY_QUEUE_SIZE]; ///< Key event ring buffer
+  uint8_t _keyHead;                                   ///< Oldest queued event
+  uint8_t _keyCount;                                  ///< Queued events
+  volatile bool _keysPending;                         ///< Key interrupt signaled, set from ISR
+  bool _keysUnsettled;                                ///< Last scan saw keys not yet debounced
+
+private:
+  void _initDevices();                                              ///< Apply default address and row count to each device
+  void _resetDevice(uint8_t devIdx);                                ///< Clear masks, caches, keys and counters of a device slot
+  void _checkAddresses();                                           ///< Set each device online, or conflicting if its address is taken
+  void _beginBuses(uint32_t clockHz);                               ///< Start every bus slot and set its clock
+  void _beginDevices();                                             ///< Allocate the buffer and configure the devices in phases
+  bool _probe(uint8_t addr);                                        ///< Address-only transaction on the active transport, true on ACK
+  void _write(uint8_t devIdx);                                      ///< Write dirty columns of the display buffer
+  bool _writeNextRange(uint8_t devIdx);                             ///< Write the first dirty range, false if none
+  void _showInterleaved();                                          ///< show() over several buses, one range per bus in turn
+  inline uint8_t &_txDirty(uint8_t devIdx);                         ///< Columns to transmit: front or drawing buffer mask
+  inline void _txBegin(uint8_t addr);                               ///< Start a transaction on the active transport
+  inline void _txBeginDev(uint8_t devIdx);                          ///< Select the device's bus and channel, then start a transaction
+  inline void _txWrite(uint8_t data);                               ///< Queue one byte on the active transport
+  inline uint8_t _txEnd();                                          ///< Send the transaction on the active transport
+  bool _txEndDev(uint8_t devIdx);                                   ///< Send the transaction and count its status
+  bool _command(uint8_t devIdx, uint8_t cmd);                       ///< Send a one-byte command with retries
+  bool _restoreConfig(uint8_t devIdx);                              ///< Resend configuration, then mark all RAM dirty
+  void _markFailed(uint8_t devIdx);                                 ///< Degrade device health after a failed transaction
+  void _probeOffline(bool all);                                     ///< Probe offline devices (all, or the next one) when due
+  void _probeDevice(uint8_t devIdx);                                ///< Probe one offline device, restore it if it answers
+  void _backoff(uint8_t devIdx, uint8_t attempt);                   ///< Count a retry and wait before it
+  inline uint8_t _rxRequest(uint8_t addr, uint8_t quantity);        ///< Read bytes on the active transport
+  inline int _rxRead();                                             ///< Next received byte on the active transport
+  inline bool _busBusy(uint8_t busIdx);                             ///< Bus slot still running a non-blocking transfer
+  void _selectChannel(uint8_t devIdx);                              ///< Switch the multiplexer to the device's channel if needed
+  inline uint8_t _channelOf(uint8_t devIdx) const;                  ///< Device channel, HT16K33_MUX_NONE without multiplexer
+  inline uint8_t _firstDev() const { return _orderFirst; }          ///< First device in channel order
+  void _linkOrder();                                                ///< Rebuild the channel-ordered device list
+  bool _readKeyRam(uint8_t devIdx, uint16_t keys[3]);               ///< Read the key RAM of a device
+  bool _pushKeyEvent(uint8_t devIdx, uint8_t keyIdx, bool pressed); ///< Queue a key event
+  inline uint8_t _nextDev(uint8_t devIdx) const { return _devs[devIdx].next; }         ///< Next device in channel order, devsNum when done
+  bool _readRam(uint8_t devIdx, uint8_t first, uint8_t count, uint16_t *words);         ///< Read display RAM columns
+  uint8_t _bindBus(uint8_t devIdx, TwoWire *wire, SBK_HT16K33_Bus *bus);                ///< Find or add the bus slot of a device
+  inline void _putColumn(uint8_t devIdx, uint8_t colIdx, uint16_t bits, uint16_t mask); ///< Masked column store, marks it dirty on change
+  inline uint16_t _rowsMask(uint8_t devIdx) const;                                      ///< Bit mask of the active rows
+  static void _transpose8(const uint8_t in[8], uint8_t out[8]);                        ///< 8×8 bit matrix transpose
+  static uint16_t _barWord(uint8_t rows, uint8_t level, uint8_t peak, uint8_t dir);      ///< Column word of a bar
+
+  static const uint16_t _barMasks[17]; ///< _barMasks[n] = n lowest bits set (PROGMEM)
+  inline uint16_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+};
 
-  void _write(uint8_t devIdx); ///< Write full display buffer
-  inline uint8_t _colIndex(uint8_t devIdx, uint8_t colIdx) const;
+/**
+ * @brief Compile-time row count list for SBK_HT16K33_Static (internal helper).
+ *
+ * Devices beyond the end of the list use 8 rows.
+ */
+template <uint8_t... ROWS>
+struct SBK_HT16K33_Rows
+{
+  static constexpr uint8_t at(uint8_t) { return 8; }
+  static constexpr bool valid() { return true; }
+};
+
+template <uint8_t R0, uint8_t... ROWS>
+struct SBK_HT16K33_Rows<R0, ROWS...>
+{
+  static constexpr uint8_t at(uint8_t devIdx) { return devIdx == 0 ? R0 : SBK_HT16K33_Rows<ROWS...>::at(devIdx - 1); }
+  static constexpr bool valid() { return (R0 == 8 || R0 == 12 || R0 == 16) && SBK_HT16K33_Rows<ROWS...>::valid(); }
+};
+
+/**
+ * @brief Statically allocated storage for SBK_HT16K33_Static (internal helper).
+ *
+ * Inherited ahead of SBK_HT16K33 so the arrays exist before the driver base is constructed.
+ */
+template <uint8_t N_DEVS>
+struct SBK_HT16K33_StaticStorage
+{
+  SBK_HT16K33_StaticStorage() : _devStore(), _frame() {}
+
+  SBK_HT16K33_Device _devStore[N_DEVS];
+  uint16_t _frame[N_DEVS * 8];
+};
+
+/**
+ * @class SBK_HT16K33_Static
+ * @brief Heap-free SBK_HT16K33 variant sized at compile time.
+ *
+ * @tparam N_DEVS Number of HT16K33 devices (1 to SBK_HT16K33_MAX_DEVICES).
+ * @tparam ROWS   Optional row count per device (8, 12 or 16). Missing entries default to 8.
+ *
+ * The device table and display buffer are member arrays, so `begin()` never allocates.
+ * `setLed()`, `getLed()`, `maxRows()` and `devsNum()` are resolved against the template
+ * parameters, letting the compiler fold index math and bounds checks when arguments are constants.
+ *
+ * ```cpp
+ * SBK_HT16K33_Static<2, 8, 16> ht; // device 0: 20-SOP, device 1: 28-SOP
+ * ```
+ *
+ * @note Row counts are fixed by the template: `setDriverRows()` is not available.
+ */
+template <uint8_t N_DEVS, uint8_t... ROWS>
+class SBK_HT16K33_Static : private SBK_HT16K33_StaticStorage<N_DEVS>, public SBK_HT16K33
+{
+  static_assert(N_DEVS >= 1 && N_DEVS <= SBK_HT16K33_MAX_DEVICES, "SBK_HT16K33_Static supports 1 to SBK_HT16K33_MAX_DEVICES devices");
+  static_assert(sizeof...(ROWS) <= N_DEVS, "More row counts than devices");
+  static_assert(SBK_HT16K33_Rows<ROWS...>::valid(), "Row counts must be 8, 12 or 16");
+
+  typedef SBK_HT16K33_StaticStorage<N_DEVS> Storage;
+
+public:
+  SBK_HT16K33_Static()
+      : Storage(),
+        SBK_HT16K33(N_DEVS, Storage::_devStore, Storage::_frame)
+  {
+    for (uint8_t i = 0; i < N_DEVS; i++)
+      _devs[i].maxRows = maxRows(i);
+  }
+
+  void setDriverRows(uint8_t devIdx, uint8_t rowsCount) = delete;
+  uint8_t beginAuto(uint32_t clockHz = 0) = delete; // device count is fixed by the template
+
+  /// Number of active row lines for a device, from the template parameters.
+  static constexpr uint8_t maxRows(uint8_t devIdx) { return SBK_HT16K33_Rows<ROWS...>::at(devIdx); }
+
+  /// Total number of addressable LED segments for a device.
+  static constexpr uint8_t maxSegments(uint8_t devIdx) { return maxRows(devIdx) * _defaultColBufferSize; }
+
+  /// Number of devices, from the template parameters.
+  static constexpr uint8_t devsNum() { return N_DEVS; }
+
+  /// @copydoc SBK_HT16K33::setLed
+  void setLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx, bool state)
+  {
+    if (devIdx >= N_DEVS || rowIdx >= maxRows(devIdx) || colIdx >= _defaultColBufferSize)
+      return;
+
+    uint16_t &word = Storage::_frame[devIdx * _defaultColBufferSize + colIdx];
+    uint16_t data = state ? (word | (1 << rowIdx)) : (word & ~(1 << rowIdx));
+
+    if (data != word)
+    {
+      word = data;
+      Storage::_devStore[devIdx].dirty |= (1 << colIdx);
+    }
+  }
+
+  /// @copydoc SBK_HT16K33::getLed
+  bool getLed(uint8_t devIdx, uint8_t rowIdx, uint8_t colIdx) const
+  {
+    if (devIdx >= N_DEVS || rowIdx >= maxRows(devIdx) || colIdx >= _defaultColBufferSize)
+      return false;
+
+    return (Storage::_frame[devIdx * _defaultColBufferSize + colIdx] >> rowIdx) & 0x01;
+  }
 };
@@ -0,0 +1,292 @@
+/**
+ * @file SBK_HT16K33_Background.h
+ * @brief SBK_HT16K33 driver refreshed by a background task (ESP32 / FreeRTOS).
+ *
+ * SBK_HT16K33_Background moves display I/O off the drawing thread. `loop()` draws as usual and
+ * `show()` publishes the frame into a lock-free triple buffer without touching the bus; a
+ * dedicated task takes the latest published frame and sends the columns that changed.
+ *
+ * ```cpp
+ * #include <SBK_HT16K33_Background.h>
+ *
+ * SBK_HT16K33_Background ht(4);
+ *
+ * void setup() {
+ *   ht.begin();
+ *   ht.startTask(); // core 0 by default, loop() runs on core 1
+ * }
+ *
+ * void loop() {
+ *   drawNextFrame(); // setLed() calls...
+ *   ht.show();       // wait-free: copies the frame and returns
+ * }
+ * ```
+ *
+ * Requires `<atomic>`: ESP32 cores or the host simulator, not AVR. On other platforms `refresh()`
+ * can be driven by any single consumer thread, e.g. a `std::thread` on the host (see
+ * `extras/host/hostBackground.cpp`).
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.0
+ *
+ * @license MIT
+ *
+ * Repository: https://github.com/sbarabe/SBK_HT16K33
+ */
+
+#pragma once
+
+#if defined(__AVR__)
+#error "SBK_HT16K33_Background.h needs <atomic>, not available on AVR"
+#endif
+
+#include <atomic>
+#include <string.h>
+#include "SBK_HT16K33.h"
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+/**
+ * @class SBK_HT16K33_Background
+ * @brief SBK_HT16K33 whose display RAM updates are sent by a single consumer (task or thread).
+ *
+ * Thread roles once the consumer runs:
+ * - Producer (`loop()`): drawing functions and `show()`.
+ * - Consumer (task): `refresh()`, the only code touching the bus.
+ *
+ * Calls using the bus directly (`setBrightness()`, `setBlink()`, key scanning, `begin()`) must be
+ * made before `startTask()` or after `stopTask()`. The consumer keeps its own copy of the last frame
+ * sent (the double buffer front), so the producer may draw while a frame is being written.
+ */
+class SBK_HT16K33_Background : public SBK_HT16K33
+{
+public:
+  /**
+   * @brief Construct the driver. Buffers are allocated by `begin()`.
+   *
+   * @param devsNum Number of HT16K33 devices (see `SBK_HT16K33::SBK_HT16K33()`).
+   */
+  explicit SBK_HT16K33_Background(uint8_t devsNum = 1)
+      : SBK_HT16K33(devsNum), _slots(nullptr), _backSlot(0), _frontSlot(1), _middle(2),
+        _published(0), _dropped(0), _written(0)
+  {
+#if defined(ESP32)
+    _run = false;
+    _taskActive = false;
+#endif
+  }
+
+  ~SBK_HT16K33_Background()
+  {
+#if defined(ESP32)
+    stopTask();
+#endif
+    free(_slots);
+  }
+
+  /**
+   * @brief Initialize the devices and allocate the frame slots (3 × 16 bytes per device).
+   *
+   * @param clockHz I2C clock, 0 keeps the bus default (see `SBK_HT16K33::begin()`).
+   * @return false if an allocation failed.
+   */
+  bool begin(uint32_t clockHz = 0)
+  {
+    SBK_HT16K33::begin(clockHz);
+    return _beginSlots();
+  }
+
+  /**
+   * @brief Find the devices present, initialize them and allocate the frame slots.
+   *
+   * @param clockHz I2C clock, 0 keeps the bus default (see `SBK_HT16K33::beginAuto()`).
+   * @return Number of devices found, 0 if none or if an allocation failed.
+   */
+  uint8_t beginAuto(uint32_t clockHz = 0)
+  {
+    uint8_t found = SBK_HT16K33::beginAuto(clockHz);
+    return (found && _beginSlots()) ? found : 0;
+  }
+
+  /**
+   * @brief Publish the drawing buffer to the consumer. Wait-free, never touches the bus.
+   *
+   * Does nothing if no column changed since the previous call. A published frame not yet taken
+   * by the consumer is replaced by the new one (see `framesDropped()`).
+   */
+  void show()
+  {
+    if (!_slots)
+      return;
+
+    bool changed = false;
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+      changed |= _devs[d].dirty != 0;
+      _devs[d].dirty = 0;
+    }
+    if (!changed)
+      return;
+
+    memcpy(_slot(_backSlot), _buffer, _frameWords() * sizeof(uint16_t));
+
+    uint8_t prev = _middle.exchange(_backSlot | _fresh, std::memory_order_acq_rel);
+    if (prev & _fresh)
+      _dropped++;
+    _backSlot = prev & _slotMask;
+    _published++;
+  }
+
+  /**
+   * @brief Consumer step: send the latest published frame, if any.
+   *
+   * Only the columns differing from the last frame sent are written.
+   * Must only be called from one thread (the background task).
+   *
+   * @return true if a frame was taken, false if nothing new was published.
+   */
+  bool refresh()
+  {
+    if (!_front || !(_middle.load(std::memory_order_acquire) & _fresh))
+      return false; // nothing new, or double buffering disabled through a base class reference
+
+    _frontSlot = _middle.exchange(_frontSlot, std::memory_order_acq_rel) & _slotMask;
+    const uint16_t *frame = _slot(_frontSlot);
+
+    for (uint8_t d = 0; d < _devsNum; d++)
+    {
+      uint8_t changed = 0;
+      for (uint8_t c = 0; c < maxColumns(); c++)
+      {
+        uint16_t index = d * maxColumns() + c;
+        if (_front[index] != frame[index])
+        {
+          _front[index] = frame[index];
+          changed |= (1 << c);
+        }
+      }
+      _devs[d].frontDirty |= changed;
+    }
+
+    SBK_HT16K33::show();
+    _written++;
+    return true;
+  }
+
+  /// Frames published by `show()` (producer side).
+  unsigned long framesPublished() const { return _published; }
+
+  /// Published frames replaced before the consumer took them (producer side).
+  unsigned long framesDropped() const { return _dropped; }
+
+  /// Frames taken and sent by `refresh()` (consumer side).
+  unsigned long framesWritten() const { return _written; }
+
+#if defined(ESP32)
+  /**
+   * @brief Start the FreeRTOS task calling `refresh()`.
+   *
+   * @param core       Core the task is pinned to (loop() runs on core 1 by default).
+   * @param priority   Task priority.
+   * @param idleTicks  Ticks to sleep when no new frame is available.
+   * @param stackSize  Task stack size in bytes.
+   *
+   * @return false if `begin()` failed or the task could not be created.
+   */
+  bool startTask(BaseType_t core = 0, UBaseType_t priority = 1, TickType_t idleTicks = 1, uint32_t stackSize = 2048)
+  {
+    if (!_slots || _taskActive)
+      return false;
+
+    _idleTicks = idleTicks ? idleTicks : 1;
+    _run = true;
+    _taskActive = true;
+    if (xTaskCreatePinnedToCore(_taskEntry, "SBK_HT16K33", stackSize, this, priority, nullptr, core) != pdPASS)
+    {
+      _run = false;
+      _taskActive = false;
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Stop the task after its current frame and wait until it has exited.
+   */
+  void stopTask()
+  {
+    _run = false;
+    while (_taskActive)
+      vTaskDelay(1);
+  }
+#endif
+
+  // Bus updates belong to the consumer: the immediate and polled paths are disabled
+  void show(uint8_t devIdx) = delete;
+  void showAsync() = delete;
+  void showAsync(uint8_t devIdx) = delete;
+  bool poll() = delete;
+  void swap() = delete;
+  void present() = delete;
+  uint8_t verify() = delete;
+
+  // refresh() diffs each frame against the front buffer: it stays enabled
+  bool setDoubleBuffer(bool enable) = delete;
+
+private:
+  static constexpr uint8_t _fresh = 0x04;    ///< Middle slot holds a frame not taken yet
+  static constexpr uint8_t _slotMask = 0x03; ///< Slot index bits
+
+  uint16_t _frameWords() const { return _devsCapacity * maxColumns(); } // devsNum() may grow with beginAuto()
+
+  bool _beginSlots()
+  {
+    if (!_buffer || !SBK_HT16K33::setDoubleBuffer(true))
+      return false;
+
+    if (!_slots)
+      _slots = (uint16_t *)calloc(3 * _frameWords(), sizeof(uint16_t));
+    if (!_slots)
+    {
+      SBK_HT16K33_LOGLN(SBK_HT16K33_LOG_ERROR, "[Background] Frame slot allocation failed");
+      return false;
+    }
+
+    return true;
+  }
+  uint16_t *_slot(uint8_t slotIdx) const { return _slots + slotIdx * _frameWords(); }
+
+  uint16_t *_slots;             ///< Three frames of devsNum × maxColumns() words
+  uint8_t _backSlot;            ///< Slot written by the producer
+  uint8_t _frontSlot;           ///< Slot read by the consumer
+  std::atomic<uint8_t> _middle; ///< Slot exchanged between both sides, plus _fresh flag
+  unsigned long _published;
+  unsigned long _dropped;
+  unsigned long _written;
+
+#if defined(ESP32)
+  static void _taskEntry(void *arg)
+  {
+    SBK_HT16K33_Background *self = static_cast<SBK_HT16K33_Background *>(arg);
+
+    while (self->_run)
+    {
+      if (!self->refresh())
+        vTaskDelay(self->_idleTicks);
+    }
+
+    self->_taskActive = false;
+    vTaskDelete(nullptr);
+  }
+
+  std::atomic<bool> _run;        ///< Cleared by stopTask()
+  std::atomic<bool> _taskActive; ///< Cleared by the task when it exits
+  TickType_t _idleTicks = 1;
+#endif
+};
@@ -0,0 +1,229 @@
+/**
+ * @file SBK_HT16K33_Canvas.h
+ * @brief Logical pixel canvas spanning several HT16K33 devices.
+ *
+ * SBK_HT16K33_Canvas maps a logical (x, y) coordinate space onto a grid of tiles, each tile
+ * being one HT16K33 device with its own rotation and mirroring. The mapping is resolved once,
+ * when tiles are assigned, into small lookup tables, so `drawPixel()` only does table lookups
+ * before calling `SBK_HT16K33::setLed()`.
+ *
+ * ```cpp
+ * SBK_HT16K33 ht(8);
+ * SBK_HT16K33_Canvas<8, 1, 8, 16> wall(ht); // 64×16 wall of 8 devices, 8 cols × 16 rows each
+ *
+ * wall.setChain();           // tile n = device n, left to right
+ * wall.drawPixel(42, 3, true);
+ * ht.show();
+ * ```
+ *
+ * @author
+ * Samuel Barabé (Smart Builds & Kits)
+ *
+ * @version 2.0.0
+ *
+ * @license MIT
+ *
+ * Repository: https://github.com/sbarabe/SBK_HT16K33
+ */
+
+#pragma once
+
+#include "SBK_HT16K33.h"
+
+// Tile orientation flags (combine one rotation with optional mirroring)
+#define HT16K33_TILE_ROT_0 0x00    ///< Tile x = device column, tile y = device row
+#define HT16K33_TILE_ROT_90 0x01   ///< Rotated 90° clockwise
+#define HT16K33_TILE_ROT_180 0x02  ///< Rotated 180°
+#define HT16K33_TILE_ROT_270 0x03  ///< Rotated 270° clockwise
+#define HT16K33_TILE_MIRROR_X 0x04 ///< Tile x reversed before rotation
+#define HT16K33_TILE_MIRROR_Y 0x08 ///< Tile y reversed before rotation
+
+/**
+ * @class SBK_HT16K33_Canvas
+ * @brief Tiled logical canvas on top of an SBK_HT16K33 driver.
+ *
+ * @tparam TILES_X Number of tiles horizontally.
+ * @tparam TILES_Y Number of tiles vertically.
+ * @tparam TILE_W  Tile width in pixels (at most 8 unrotated, 16 when rotated 90°/270°).
+ * @tparam TILE_H  Tile height in pixels (at most 16 unrotated, 8 when rotated 90°/270°).
+ *
+ * Pixels falling on unassigned tiles, or beyond the rows configured with `setDriverRows()`
+ * for a tile's device, are ignored.
+ *
+ * Lookup tables take `WIDTH + HEIGHT + TILES_Y × WIDTH + TILES_X × HEIGHT + TILES_X × TILES_Y` bytes,
+ * e.g. 280 bytes for a 64×16 wall of 8 tiles.
+ */
+template <uint8_t TILES_X, uint8_t TILES_Y, uint8_t TILE_W, uint8_t TILE_H>
+class SBK_HT16K33_Canvas
+{
+  static_assert(TILES_X >= 1 && TILES_Y >= 1, "Canvas needs at least one tile");
+  static_assert(TILE_W >= 1 && TILE_W <= 16 && TILE_H >= 1 && TILE_H <= 16, "Tile sides must be 1 to 16 pixels");
+  static_assert(TILES_X * TILE_W <= 255 && TILES_Y * TILE_H <= 255, "Canvas sides must not exceed 255 pixels");
+  static_assert(TILE_W <= 8 || TILE_H <= 8, "One tile side must fit the 8 device columns");
+
+public:
+  /**
+   * @brief Construct a canvas drawing through an existing driver. All tiles start unassigned.
+   *
+   * @param driver Driver owning the devices. It must outlive the canvas.
+   */
+  explicit SBK_HT16K33_Canvas(SBK_HT16K33 &driver)
+      : _driver(driver), _tileOfX(), _tileOfY(), _xCode(), _yCode()
+  {
+    for (uint8_t t = 0; t < TILES_X * TILES_Y; t++)
+      _tileDev[t] = _noDevice;
+
+    // Any orientation valid for the tile size, to fill the tables
+    uint8_t orientation = TILE_W <= 8 ? HT16K33_TILE_ROT_0 : HT16K33_TILE_ROT_90;
+
+    for (uint8_t ty = 0; ty < TILES_Y; ty++)
+      for (uint8_t tx = 0; tx < TILES_X; tx++)
+        setTile(tx, ty, _noDevice, orientation);
+  }
+
+  /// Canvas width in pixels.
+  static constexpr uint8_t width() { return TILES_X * TILE_W; }
+
+  /// Canvas height in pixels.
+  static constexpr uint8_t height() { return TILES_Y * TILE_H; }
+
+  /**
+   * @brief Assign a device to a tile.
+   *
+   * @param tileX       Tile column (0 to TILES_X - 1).
+   * @param tileY       Tile row (0 to TILES_Y - 1).
+   * @param devIdx      Device index in the driver, or 0xFF to leave the tile unassigned.
+   * @param orientation One `HT16K33_TILE_ROT_*` value, optionally OR-ed with `HT16K33_TILE_MIRROR_*`.
+   *
+   * @return true if the tile was assigned, false if the tile is out of range or its size does not
+   *         fit the device (8 columns × 16 rows) in the requested orientation.
+   */
+  bool setTile(uint8_t tileX, uint8_t tileY, uint8_t devIdx, uint8_t orientation = HT16K33_TILE_ROT_0)
+  {
+    if (tileX >= TILES_X || tileY >= TILES_Y)
+      return false;
+
+    bool rotated = orientation & 0x01; // 90° or 270°
+    if ((rotated ? TILE_H : TILE_W) > 8)
+      return false; // more than 8 columns needed
+
+    _tileDev[tileY * TILES_X + tileX] = devIdx;
+
+    // Tile x axis: code contributed by each canvas x of this tile
+    for (uint8_t lx = 0; lx < TILE_W; lx++)
+    {
+      uint8_t x = tileX * TILE_W + lx;
+      uint8_t mx = (orientation & HT16K33_TILE_MIRROR_X) ? TILE_W - 1 - lx : lx;
+
+      _tileOfX[x] = tileX;
+      _xCode[tileY][x] = _axisCode(orientation, true, mx);
+    }
+
+    // Tile y axis: code contributed by each canvas y of this tile
+    for (uint8_t ly = 0; ly < TILE_H; ly++)
+    {
+      uint8_t y = tileY * TILE_H + ly;
+      uint8_t my = (orientation & HT16K33_TILE_MIRROR_Y) ? TILE_H - 1 - ly : ly;
+
+      _tileOfY[y] = tileY;
+      _yCode[tileX][y] = _axisCode(orientation, false, my);
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief Assign devices to tiles in order: device n goes to tile n, row by row.
+   *
+   * @param orientation Orientation applied to every tile.
+   *
+   * Tiles beyond the driver's device count stay unassigned.
+   */
+  void setChain(uint8_t orientation = HT16K33_TILE_ROT_0)
+  {
+    for (uint8_t t = 0; t < TILES_X * TILES_Y; t++)
+      setTile(t % TILES_X, t / TILES_X, t < _driver.devsNum() ? t : _noDevice, orientation);
+  }
+
+  /**
+   * @brief Set a pixel of the canvas.
+   *
+   * @param x     Canvas x (0 to width() - 1). Out-of-range values are ignored.
+   * @param y     Canvas y (0 to height() - 1). Out-of-range values are ignored.
+   * @param state true = LED ON, false = LED OFF.
+   *
+   * You must call the driver's `.show()` to apply the changes.
+   */
+  void drawPixel(int16_t x, int16_t y, bool state)
+  {
+    if ((uint16_t)x >= width() || (uint16_t)y >= height())
+      return;
+
+    uint8_t tx = _tileOfX[x];
+    uint8_t ty = _tileOfY[y];
+    uint8_t cell = _xCode[ty][x] + _yCode[tx][y];
+
+    _driver.setLed(_tileDev[ty * TILES_X + tx], cell & 0x0F, cell >> 4, state);
+  }
+
+  /**
+   * @brief Get a pixel of the canvas from the driver's buffer.
+   *
+   * @return true if the LED is ON, false otherwise or out of range.
+   */
+  bool getPixel(int16_t x, int16_t y) const
+  {
+    if ((uint16_t)x >= width() || (uint16_t)y >= height())
+      return false;
+
+    uint8_t tx = _tileOfX[x];
+    uint8_t ty = _tileOfY[y];
+    uint8_t cell = _xCode[ty][x] + _yCode[tx][y];
+
+    return _driver.getLed(_tileDev[ty * TILES_X + tx], cell & 0x0F, cell >> 4);
+  }
+
+  /**
+   * @brief Returns the device assigned to a tile, 0xFF if none.
+   */
+  uint8_t tileDevice(uint8_t tileX, uint8_t tileY) const
+  {
+    return (tileX < TILES_X && tileY < TILES_Y) ? _tileDev[tileY * TILES_X + tileX] : _noDevice;
+  }
+
+  /**
+   * @brief Clear the buffers of all devices of the driver.
+   */
+  void clear() { _driver.clear(); }
+
+private:
+  static constexpr uint8_t _noDevice = 0xFF;
+
+  /**
+   * @brief Cell code contributed by one tile axis: (column << 4) or row.
+   *
+   * Each axis of a rotated rectangle maps to either the device column or the device row,
+   * so the x and y codes of a pixel add up without carry to (column << 4) | row.
+   */
+  static uint8_t _axisCode(uint8_t orientation, bool xAxis, uint8_t pos)
+  {
+    switch (orientation & 0x03)
+    {
+    case HT16K33_TILE_ROT_90:
+      return xAxis ? TILE_W - 1 - pos : pos << 4;
+    case HT16K33_TILE_ROT_180:
+      return xAxis ? (TILE_W - 1 - pos) << 4 : TILE_H - 1 - pos;
+    case HT16K33_TILE_ROT_270:
+      return xAxis ? pos : (TILE_H - 1 - pos) << 4;
+    default: // HT16K33_TILE_ROT_0
+      return xAxis ? pos << 4 : pos;
+    }
+  }
+
+  SBK_HT16K33 &_driver;
+  uint8_t _tileOfX[TILES_X * TILE_W];           ///< Canvas x → tile column
+  uint8_t _tileOfY[TILES_Y * TILE_H];           ///< Canvas y → tile row
+  uint8_t _xCode[TILES_Y][TILES_X * TILE_W];    ///< Per tile row, canvas x → cell code
+  uint8_t _yCode[TILES_X][TILES_Y * TILE_H];    ///< Per tile column, canvas y → cell code
+  uint8_t _tileDev[TILES_X * TILES_Y];          ///< Tile → device index, 0xFF if unassigned
+};